@@ -0,0 +1,29 @@
+# Writes a header with one enum per resource type, listing every file found under Content/.
+# Enumerators index dense arrays at runtime, and referencing a missing asset fails to compile.
+function(generate_resource_ids output)
+    set(header "// Generated from the Content folder, do not edit\n\n#pragma once\n\n#include <array>\n#include <cstddef>\n#include <string_view>\n")
+
+    foreach(type IN ITEMS Texture Sound Font Music)
+        file(GLOB files CONFIGURE_DEPENDS ${CMAKE_CURRENT_SOURCE_DIR}/Content/${type}s/*)
+        list(SORT files)
+
+        set(enumerators "")
+        set(filenames "")
+
+        foreach(file IN LISTS files)
+            get_filename_component(filename ${file} NAME)
+            get_filename_component(stem ${file} NAME_WE)
+            string(MAKE_C_IDENTIFIER ${stem} identifier)
+            string(APPEND enumerators "    ${identifier},\n")
+            string(APPEND filenames "    \"${filename}\",\n")
+        endforeach()
+
+        string(TOUPPER ${type} prefix)
+        string(APPEND header "\nenum class ${type}Id\n{\n${enumerators}    Count\n};\n")
+        string(APPEND header "\ninline constexpr std::array<std::string_view, std::size_t(${type}Id::Count)> ${prefix}_FILENAMES =\n{\n${filenames}};\n")
+    endforeach()
+
+    # Only touch the header when the content list changed, so that nothing recompiles needlessly
+    file(WRITE ${output}.tmp "${header}")
+    configure_file(${output}.tmp ${output} COPYONLY)
+endfunction()
\ No newline at end of file
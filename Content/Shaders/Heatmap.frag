@@ -0,0 +1,22 @@
+#version 120
+
+uniform sampler2D sourceTexture;
+
+const float LAYER_COUNT = 32.0;
+
+void main()
+{
+    const vec3 colors[6] = vec3[6](
+        vec3(0.0, 0.0, 0.0), vec3(0.0, 0.0, 1.0), vec3(0.0, 1.0, 0.0),
+        vec3(1.0, 1.0, 0.0), vec3(1.0, 0.0, 0.0), vec3(1.0, 1.0, 1.0)
+    );
+
+    vec2 uv = gl_TexCoord[0].xy;
+
+    float layers = clamp(texture2D(sourceTexture, uv).r * LAYER_COUNT, 0.0, 5.0);
+    int index = int(floor(layers));
+
+    vec3 color = mix(colors[index], colors[min(index + 1, 5)], layers - float(index));
+
+    gl_FragColor = vec4(color, 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,8 @@
+#version 120
+
+const float LAYER_WEIGHT = 1.0 / 32.0;
+
+void main()
+{
+    gl_FragColor = vec4(vec3(LAYER_WEIGHT), 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+// Copyright (c) 2025 Adel Hales
+
+#pragma once
+
+#include <map>
+#include <optional>
+#include <string>
+
+#include "Utils/AllocationTracker.h"
+
+// Attributes every frame's allocations to the active scene and reports them when the engine shuts down
+class AllocationMonitor
+{
+private:
+    struct SceneAllocations
+    {
+        std::size_t frames = 0;
+        Allocation::FrameCounters total = {};
+        AllocationCounters peakUpdate = {};
+        std::size_t steadyUpdateFrames = 0;
+    };
+
+    std::map<std::string, SceneAllocations> scenes_;
+    SceneAllocations* scene_;
+    std::string sceneName_;
+    std::size_t sceneFrames_;
+    std::optional<std::string> nextScene_;
+
+public:
+    AllocationMonitor();
+    ~AllocationMonitor();
+
+    AllocationMonitor(const AllocationMonitor&) = delete;
+    AllocationMonitor& operator=(const AllocationMonitor&) = delete;
+
+    void SetScene(const std::string& name);
+    void FinishFrame();
+
+private:
+    void CountFrame(const Allocation::FrameCounters& frame);
+    void WriteReport() const;
+};
\ No newline at end of file
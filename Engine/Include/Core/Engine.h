@@ -4,8 +4,10 @@
 
 #include <SFML/Graphics/RenderWindow.hpp>
 
+#include "Core/AllocationMonitor.h"
 #include "Core/EngineContext.h"
 #include "Core/EngineVisitor.h"
+#include "Core/LoadingScreen.h"
 #include "Core/Overlay.h"
 #include "Scene/SceneFactory.h"
 
@@ -21,6 +23,9 @@ private:
     Overlay overlay_;
     bool cursorWasVisible_;
 
+    LoadingScreen loadingScreen_;
+    AllocationMonitor allocations_;
+
 public:
     Engine();
 
@@ -39,9 +44,11 @@ private:
     void EventWindowFocusLost();
     void EventWindowFocusGained();
     void EventWindowScreenshot() const;
+    void EventOverdrawToggle();
     void EventGamepadConnected(int id);
     void EventGamepadDisconnected(int id);
     void EventSceneChange(const std::string& name);
+    void EventScenePrefetch(const std::string& name);
     void EventSceneRestart();
     void EventSceneMenuReturn();
     void EventOverlayPauseToggle();
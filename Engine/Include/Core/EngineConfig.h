@@ -6,6 +6,8 @@
 #include <SFML/System/Time.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 struct EngineConfig
@@ -20,6 +22,19 @@ struct EngineConfig
     float cursorSpeed;
     sf::Color cursorColor;
     float joystickDeadzone;
+    sf::Time resourceUploadBudget;
+    std::size_t textureMemoryBudget;
+    std::size_t resourceMemoryBudget;
+    std::size_t voiceCount;
+    float soundCullDistance;
+    float soundCullVolume;
+    sf::Time saveInterval;
+    bool saveBinary;
+    float inputSampleRate;
+    sf::Time simulationBudget;
+    std::uint64_t randomSeed;
+    std::size_t frameArenaSize;
+    std::size_t allocationWarmup;
 
     EngineConfig();
 };
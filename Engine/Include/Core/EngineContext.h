@@ -4,6 +4,7 @@
 
 #include <SFML/Graphics/RenderWindow.hpp>
 
+#include "Core/EngineConfig.h"
 #include "Managers/AudioManager.h"
 #include "Managers/ClipboardManager.h"
 #include "Managers/CursorManager.h"
@@ -15,15 +16,19 @@
 #include "Managers/SaveManager.h"
 #include "Managers/SceneManager.h"
 #include "Managers/ScreenshotManager.h"
+#include "Managers/ShaderManager.h"
 #include "Managers/TimeManager.h"
+#include "Utils/FrameArena.h"
 
 struct EngineContext
 {
+    FrameArena arena;
     RandomManager random;
     TimeManager time;
     SaveManager save;
     ClipboardManager clipboard;
     ResourceManager resources;
+    ShaderManager shaders;
     AudioManager audio;
     InputManager input;
     RenderManager renderer;
@@ -33,5 +38,5 @@ struct EngineContext
     SceneManager scenes;
 
     EngineContext(sf::RenderWindow& window) :
-        screenshot(window), cursor(window), gui(window) {}
+        arena(gConfig.frameArenaSize), renderer(shaders), screenshot(window), cursor(window), gui(window) {}
 };
\ No newline at end of file
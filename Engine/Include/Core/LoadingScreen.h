@@ -0,0 +1,21 @@
+// Copyright (c) 2025 Adel Hales
+
+#pragma once
+
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+class LoadingScreen
+{
+private:
+    sf::RectangleShape background_;
+    sf::RectangleShape bar_;
+    sf::RectangleShape progress_;
+    sf::Text text_;
+
+public:
+    LoadingScreen();
+
+    void Render(sf::RenderWindow& window, float progress);
+};
\ No newline at end of file
@@ -3,28 +3,19 @@
 #pragma once
 
 #include <SFML/Graphics/RectangleShape.hpp>
-#include <SFML/Graphics/Texture.hpp>
 
-#include <vector>
-
-struct AnimatedShapeConfig
-{
-    const sf::Texture* texture;
-    std::vector<int> frameCountPerRow;
-    float frameDuration;
-    bool looping = true;
-};
+#include "Graphics/AnimationClip.h"
 
 class AnimatedShape : public sf::RectangleShape
 {
 private:
-    AnimatedShapeConfig config_;
-    sf::Vector2i currentFrame_;
-    sf::Vector2i frameSize_;
+    const AnimationClip* clip_;
+    int row_;
+    int frame_;
     float elapsedTime_;
 
 public:
-    void Start(const AnimatedShapeConfig& config);
+    void Start(const AnimationClip& clip);
     bool Update(float deltaTime);
 
     void SetRow(int rowIndex);
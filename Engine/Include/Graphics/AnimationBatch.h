@@ -0,0 +1,36 @@
+// Copyright (c) 2025 Adel Hales
+
+#pragma once
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <vector>
+
+#include "Graphics/AnimationClip.h"
+
+class AnimationBatch : public sf::Drawable
+{
+private:
+    const AnimationClip& clip_;
+    std::vector<int> frames_;
+    std::vector<float> elapsedTimes_;
+    std::vector<sf::Vertex> vertices_;
+
+public:
+    AnimationBatch(const AnimationClip& clip);
+
+    void Add(sf::Vector2f center, sf::Vector2f size, sf::Color color = sf::Color::White);
+    void Update(float deltaTime);
+    void RemoveFinished();
+    void Clear();
+
+    std::size_t GetCount() const;
+
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+private:
+    void WriteTexCoords(std::size_t index);
+};
\ No newline at end of file
@@ -0,0 +1,36 @@
+// Copyright (c) 2025 Adel Hales
+
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <array>
+#include <span>
+#include <vector>
+
+class AnimationClip
+{
+private:
+    const sf::Texture& texture_;
+    std::vector<sf::IntRect> rects_;
+    std::vector<std::array<sf::Vector2f, 6>> texCoords_;
+    std::vector<int> nextFrames_;
+    std::vector<int> rowFirstFrames_;
+    float frameDuration_;
+    bool looping_;
+
+public:
+    AnimationClip(const sf::Texture& texture, std::span<const int> frameCountPerRow,
+                  float frameDuration, bool looping = true);
+
+    const sf::Texture& GetTexture() const;
+    float GetFrameDuration() const;
+
+    int GetRowFirstFrame(int rowIndex) const;
+    int GetNextFrame(int frame) const;
+    bool IsFinished(int frame) const;
+
+    const sf::IntRect& GetFrameRect(int frame) const;
+    const std::array<sf::Vector2f, 6>& GetFrameTexCoords(int frame) const;
+};
\ No newline at end of file
@@ -3,22 +3,22 @@
 #pragma once
 
 #include "Graphics/Effect.h"
+#include "Graphics/RenderTargetPool.h"
+#include "Managers/ShaderManager.h"
 
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/Shader.hpp>
 
-#include <array>
-
 class EffectBloom : public Effect
 {
 private:
-    sf::Shader downsampleShader_;
-    sf::Shader blurShader_;
-    sf::Shader additiveShader_;
-    std::array<sf::RenderTexture, 2> textures_;
+    sf::Shader& downsampleShader_;
+    sf::Shader& blurShader_;
+    sf::Shader& additiveShader_;
+    RenderTargetPool& targets_;
 
 public:
-    EffectBloom();
+    EffectBloom(ShaderManager& shaders, RenderTargetPool& targets);
 
     void Apply(const sf::Texture& input, sf::RenderTarget& output) override;
 
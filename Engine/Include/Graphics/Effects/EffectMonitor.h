@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Graphics/Effect.h"
+#include "Managers/ShaderManager.h"
 
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/System/Clock.hpp>
@@ -10,11 +11,11 @@
 class EffectMonitor : public Effect
 {
 private:
-    sf::Shader shader_;
+    sf::Shader& shader_;
     sf::Clock clock_;
 
 public:
-    EffectMonitor();
+    EffectMonitor(ShaderManager& shaders);
 
     void Apply(const sf::Texture& input, sf::RenderTarget& output) override;
 };
\ No newline at end of file
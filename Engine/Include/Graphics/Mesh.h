@@ -0,0 +1,22 @@
+// Copyright (c) 2025 Adel Hales
+
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <span>
+#include <vector>
+
+class Mesh
+{
+private:
+    std::vector<sf::Vector2f> triangles_;
+    sf::FloatRect bounds_;
+
+public:
+    Mesh(std::span<const sf::Vector2f> outline);
+
+    std::span<const sf::Vector2f> GetTriangles() const;
+    sf::FloatRect GetBounds() const;
+};
\ No newline at end of file
@@ -0,0 +1,27 @@
+// Copyright (c) 2025 Adel Hales
+
+#pragma once
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <vector>
+
+#include "Graphics/Mesh.h"
+
+class MeshBatch : public sf::Drawable
+{
+private:
+    std::vector<sf::Vertex> vertices_;
+
+public:
+    void Add(const Mesh& mesh, const sf::Transform& transform, sf::Color color);
+    void Clear();
+
+    std::size_t GetVertexCount() const;
+
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+};
\ No newline at end of file
@@ -0,0 +1,32 @@
+// Copyright (c) 2025 Adel Hales
+
+#pragma once
+
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Window/ContextSettings.hpp>
+
+#include <memory>
+#include <vector>
+
+class RenderTargetPool
+{
+private:
+    struct Entry
+    {
+        sf::RenderTexture texture;
+        sf::ContextSettings settings;
+        bool inUse;
+    };
+
+    std::vector<std::unique_ptr<Entry>> entries_;
+
+public:
+    sf::RenderTexture& Acquire(sf::Vector2u size, const sf::ContextSettings& settings = {});
+    void Release(const sf::RenderTexture& texture);
+
+    std::size_t GetTargetCount() const;
+    std::size_t GetMemoryUsage() const;
+
+private:
+    static bool IsCompatible(const Entry& entry, sf::Vector2u size, const sf::ContextSettings& settings);
+};
\ No newline at end of file
@@ -15,7 +15,7 @@ inline constexpr Tile TILE_EMPTY = -1;
 class TileMap : public sf::Drawable
 {
 private:
-    sf::Texture tileset_;
+    const sf::Texture* tileset_ = nullptr;
     sf::VertexArray vertices_;
     std::vector<Tile> tiles_;
     sf::Vector2u tileSize_;
@@ -23,12 +23,15 @@ private:
     sf::Vector2u gridSize_;
 
 public:
-    bool Init(const std::string& tilesetName, sf::Vector2u tileSize, sf::Vector2u mapSize);
+    void Init(const sf::Texture& tileset, sf::Vector2u tileSize, sf::Vector2u mapSize);
     void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
-    bool LoadFromFile(const std::string& filename, const std::string& tilesetName);
+    bool LoadFromFile(const std::string& filename, const sf::Texture& tileset);
     bool SaveToFile(const std::string& filename) const;
 
+    bool ImportFromText(const std::string& filename, const sf::Texture& tileset);
+    bool ExportToText(const std::string& filename) const;
+
     bool SetTile(sf::Vector2u position, Tile tile);
     bool IsTileValid(Tile tile) const;
     void Clear();
@@ -43,4 +46,7 @@ public:
     sf::Vector2u GetMapSize() const;
     sf::Vector2u GetGridSize() const;
     const sf::Texture& GetTexture() const;
+
+private:
+    void BuildVertices();
 };
\ No newline at end of file
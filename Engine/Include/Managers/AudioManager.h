@@ -2,11 +2,51 @@
 
 #pragma once
 
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/System/Vector2.hpp>
 #include <SFML/System/Vector3.hpp>
 
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Managers/ResourceManager.h"
+
 class AudioManager
 {
+private:
+    struct Voice
+    {
+        ResourceHandle<sf::SoundBuffer> buffer;
+        sf::Sound sound;
+        int priority = 0;
+        std::uint64_t startedAt = 0;
+        std::string scene;
+
+        explicit Voice(const sf::SoundBuffer& silence) : sound(silence) {}
+    };
+
+    sf::SoundBuffer silence_;
+    std::vector<Voice> voices_;
+    std::uint64_t playCount_ = 0;
+    std::string scope_;
+
 public:
+    AudioManager();
+
+    // Buffers are fetched by the scene beforehand, so that playing never loads or hashes on the hot path
+    void Play(const ResourceHandle<sf::SoundBuffer>& buffer, int priority = 0, std::optional<sf::Vector2f> position = std::nullopt, float volume = 100);
+
+    // Only the voices started by the current scene are affected
+    void PauseSounds(bool paused);
+    void StopSounds();
+
+    void SetScope(const std::string& scene);
+
+    std::size_t GetActiveVoiceCount() const;
+
     void SetGlobalVolume(float volume);
     float GetGlobalVolume() const;
 
@@ -15,4 +55,7 @@ public:
 
     void SetListenerDirection(sf::Vector3f direction);
     sf::Vector3f GetListenerDirection() const;
+
+private:
+    Voice* FindVoice(int priority);
 };
\ No newline at end of file
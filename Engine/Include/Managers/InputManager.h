@@ -2,23 +2,89 @@
 
 #pragma once
 
-#include <unordered_map>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "Utils/InputBindings.h"
+#include "Utils/SpscQueue.h"
+
+// An action changing state, timed in seconds from the previous frame, so that scenes can apply it at the right sub-step
+struct InputEvent
+{
+    int action = 0;
+    bool pressed = false;
+    float time = 0;
+};
 
 class InputManager
 {
 private:
-    std::unordered_multimap<int, Input::Binding> bindings_;
+    using Clock = std::chrono::steady_clock;
+
+    struct Action
+    {
+        std::vector<Input::Binding> bindings;
+        bool pressed = false;
+        bool previous = false;
+        bool polledPressed = false;
+        float heldDuration = 0;
+    };
+
+    struct Watch
+    {
+        int action = 0;
+        std::vector<Input::Binding> bindings;
+    };
+
+    struct Transition
+    {
+        int action = 0;
+        bool pressed = false;
+        std::uint64_t version = 0;
+        Clock::time_point time;
+    };
+
+    // Indexed by action, resolved once per frame so queries never touch the devices
+    std::vector<Action> actions_;
+    std::vector<InputEvent> events_;
+
+    // Keyboard and mouse bindings are sampled by the input thread when enabled on Windows, gamepads are read with the window events
+    std::vector<Watch> watches_;
+    std::atomic<std::uint64_t> watchVersion_ = 0;
+    bool watchesDirty_ = false;
+    std::mutex watchMutex_;
+    SpscQueue<Transition, 1024> transitions_;
+    std::jthread sampler_;
 
 public:
+    InputManager();
+
     void Bind(int action, const Input::Binding& binding);
     bool Pressed(int action) const;
+    bool JustPressed(int action) const;
+    bool JustReleased(int action) const;
+    float GetHeldDuration(int action) const;
+    const std::vector<InputEvent>& GetEvents() const;
     void Clear();
 
 private:
-    bool Pressed(const Input::Keyboard&) const;
-    bool Pressed(const Input::Mouse&) const;
-    bool Pressed(const Input::Gamepad&) const;
-    bool Pressed(const Input::Axis&) const;
+    friend class Engine;
+
+    void Update(float deltaTime);
+    void FinishStep();
+    void PublishWatches();
+    void Sample(std::stop_token stopToken);
+
+    const Action* FindAction(int action) const;
+    bool IsSampled(const Input::Binding& binding) const;
+
+    bool Poll(const Input::Binding&) const;
+    bool Poll(const Input::Keyboard&) const;
+    bool Poll(const Input::Mouse&) const;
+    bool Poll(const Input::Gamepad&) const;
+    bool Poll(const Input::Axis&) const;
 };
\ No newline at end of file
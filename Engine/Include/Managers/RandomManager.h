@@ -2,18 +2,35 @@
 
 #pragma once
 
-#include <SFML/Graphics/Color.hpp>
-#include <SFML/System/Angle.hpp>
-#include <SFML/System/Vector2.hpp>
+#include <array>
+#include <cstdint>
 
-#include <random>
+#include "Utils/Random.h"
+
+enum class RandomStream
+{
+    Gameplay,
+    Cosmetic,
+    AI,
+    Count
+};
 
 class RandomManager
 {
 private:
-    std::mt19937 generator_{std::random_device{}()};
+    std::uint64_t seed_;
+    std::array<Random, (std::size_t)RandomStream::Count> streams_;
 
 public:
+    RandomManager();
+
+    // Reseeds every stream, a run replayed from the same seed draws the same values
+    void Seed(std::uint64_t seed);
+    std::uint64_t GetSeed() const;
+
+    Random& Stream(RandomStream stream);
+
+    // Shortcuts drawing from the gameplay stream
     int Int(int min, int max);
     float Float(float min, float max);
     bool Bool(float probability = 0.5f);
@@ -9,6 +9,8 @@
 #include <vector>
 
 #include "Graphics/Effect.h"
+#include "Graphics/RenderTargetPool.h"
+#include "Managers/ShaderManager.h"
 
 class RenderManager
 {
@@ -18,11 +20,15 @@ private:
     sf::Texture backgroundTexture_;
     sf::RectangleShape background_;
 
+    RenderTargetPool targetPool_;
     std::vector<std::unique_ptr<Effect>> effects_;
-    sf::RenderTexture effectsTarget_;
+
+    sf::Shader* overdrawShader_;
+    sf::Shader* heatmapShader_;
+    bool overdrawVisible_;
 
 public:
-    RenderManager();
+    RenderManager(ShaderManager& shaders);
 
     void Draw(const sf::Drawable& drawable);
     void Draw(std::span<sf::Vertex> vertices, sf::PrimitiveType type);
@@ -30,9 +36,16 @@ public:
     void SetView(const sf::View& view);
     void ResetView();
 
+    void SetOverdrawVisible(bool visible);
+    bool IsOverdrawVisible() const;
+
+    const RenderTargetPool& GetTargetPool() const;
+
 private:
     friend class Engine;
 
-    void BeginDrawing();
-    const sf::Texture& FinishDrawing();
+    void BeginDrawing(bool sceneOpaque);
+    void FinishDrawing(sf::RenderTarget& window);
+
+    sf::RenderStates GetRenderStates() const;
 };
\ No newline at end of file
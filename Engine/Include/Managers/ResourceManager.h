@@ -7,20 +7,171 @@
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
+
+#include "ResourceIds.h"
+#include "Utils/ContentArchive.h"
+#include "Utils/DecodedCache.h"
+
+enum class ResourceType
+{
+    Texture,
+    Sound,
+    Font
+};
+
+// Resources a scene needs, so that they can be fetched in the background before switching to it
+struct ResourceManifest
+{
+    std::vector<TextureId> textures = {};
+    std::vector<SoundId> sounds = {};
+    std::vector<FontId> fonts = {};
+};
+
+// Shares ownership of a cached resource, which can only be evicted once every handle to it is gone
+template <class T>
+class ResourceHandle
+{
+private:
+    std::shared_ptr<std::optional<T>> resource_;
+
+public:
+    ResourceHandle() = default;
+    explicit ResourceHandle(std::shared_ptr<std::optional<T>> resource) :
+        resource_(std::move(resource)) {}
+
+    bool IsReady() const
+    {
+        return resource_ && resource_->has_value();
+    }
+
+    T* Get() const
+    {
+        return IsReady() ? &**resource_ : nullptr;
+    }
+
+    T& operator*() const
+    {
+        return **resource_;
+    }
+};
 
 class ResourceManager
 {
 private:
-    std::unordered_map<std::string, sf::Texture> textures_;
-    std::unordered_map<std::string, sf::SoundBuffer> sounds_;
-    std::unordered_map<std::string, sf::Font> fonts_;
+    using Finisher = std::function<void()>;
+
+    struct Pending
+    {
+        std::future<Finisher> result;
+        bool background = false;
+    };
+
+    template <class T>
+    struct Entry
+    {
+        std::shared_ptr<std::optional<T>> resource = std::make_shared<std::optional<T>>();
+        ContentBuffer data; // Backing memory for resources that stream from it
+        std::size_t size = 0;
+        std::string scene;
+        std::uint64_t lastUse = 0;
+    };
+
+    template <class T>
+    using Entries = std::unordered_map<std::string, Entry<T>>;
+
+    ContentArchive archive_;
+    DecodedCache cache_;
+
+    Entries<sf::Texture> textures_;
+    Entries<sf::SoundBuffer> sounds_;
+    Entries<sf::Font> fonts_;
+
+    // Dense slots indexed by generated ids, so that fetching by id never hashes a filename
+    std::array<Entry<sf::Texture>*, std::size_t(TextureId::Count)> textureSlots_{};
+    std::array<Entry<sf::SoundBuffer>*, std::size_t(SoundId::Count)> soundSlots_{};
+    std::array<Entry<sf::Font>*, std::size_t(FontId::Count)> fontSlots_{};
+
+    // Musics stream from their memory, so inflated archive entries must outlive them
+    std::unordered_map<std::string, ContentBuffer> musicData_;
+
+    std::unordered_map<std::string, Pending> pending_;
+    std::size_t requestedCount_ = 0;
+    std::size_t finishedCount_ = 0;
+
+    // Prefetched resources are held until the next scene change, requests made while prefetching stay off the loading screen
+    std::vector<ResourceHandle<sf::Texture>> prefetchedTextures_;
+    std::vector<ResourceHandle<sf::SoundBuffer>> prefetchedSounds_;
+    std::vector<ResourceHandle<sf::Font>> prefetchedFonts_;
+    bool prefetching_ = false;
+
+    std::string scope_;
+    std::uint64_t frame_ = 0;
 
 public:
-    sf::Texture* FetchTexture(const std::string& filename);
-    sf::SoundBuffer* FetchSound(const std::string& filename);
-    sf::Font* FetchFont(const std::string& filename);
-    std::optional<sf::Music> FetchMusic(const std::string& filename) const;
+    ResourceManager();
+
+    ResourceHandle<sf::Texture> FetchTexture(const std::string& filename);
+    ResourceHandle<sf::SoundBuffer> FetchSound(const std::string& filename);
+    ResourceHandle<sf::Font> FetchFont(const std::string& filename);
+    std::optional<sf::Music> FetchMusic(const std::string& filename);
+
+    ResourceHandle<sf::Texture> FetchTexture(TextureId id);
+    ResourceHandle<sf::SoundBuffer> FetchSound(SoundId id);
+    ResourceHandle<sf::Font> FetchFont(FontId id);
+    std::optional<sf::Music> FetchMusic(MusicId id);
+
+    ResourceHandle<sf::Texture> FetchTextureAsync(const std::string& filename);
+    ResourceHandle<sf::SoundBuffer> FetchSoundAsync(const std::string& filename);
+    ResourceHandle<sf::Font> FetchFontAsync(const std::string& filename);
+
+    ResourceHandle<sf::Texture> FetchTextureAsync(TextureId id);
+    ResourceHandle<sf::SoundBuffer> FetchSoundAsync(SoundId id);
+    ResourceHandle<sf::Font> FetchFontAsync(FontId id);
+
+    bool IsLoading() const;
+    float GetLoadingProgress() const;
+
+    void Prefetch(const std::string& scene, const ResourceManifest& manifest);
+    void SetScope(const std::string& scene);
+
+    std::size_t GetMemoryUsage(ResourceType type) const;
+    std::size_t GetSceneMemoryUsage(const std::string& scene) const;
+    std::size_t GetHeldMemoryUsage() const;
+
+private:
+    friend class Engine;
+
+    void Update();
+    void Evict();
+
+    template <class T, std::size_t N, class Fetch>
+    ResourceHandle<T> FetchSlot(std::array<Entry<T>*, N>& slots, std::size_t index, Entries<T>& entries,
+                                std::string_view filename, Fetch fetch, bool wait);
+
+    template <class T>
+    Entry<T>& Track(Entries<T>& entries, const std::string& filename);
+
+    template <class T>
+    bool Load(T& resource, const std::string& path, ContentBuffer& buffer) const;
+
+    std::optional<DecodedImage> DecodeImage(const std::string& path) const;
+    std::optional<DecodedSound> DecodeSound(const std::string& path) const;
+
+    void Request(const std::string& path, std::function<Finisher()> decode);
+    void Finish(const std::string& path);
+
+    std::filesystem::path GetSource(const std::string& path) const;
+    std::size_t GetFileSize(const std::string& path) const;
 };
\ No newline at end of file
@@ -4,12 +4,23 @@
 
 #include <nlohmann/json.hpp>
 
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
 #include <string_view>
+#include <thread>
+#include <vector>
 
 class SaveManager
 {
 private:
     nlohmann::json values_;
+    std::vector<nlohmann::json> pending_;
+    std::ofstream journal_;
+    std::size_t journalSize_ = 0;
+    mutable std::mutex mutex_;
+    std::condition_variable_any wakeUp_;
+    std::jthread writer_;
 
 public:
     SaveManager();
@@ -17,15 +28,25 @@ public:
 
     void Set(std::string_view key, auto value)
     {
-        values_[key] = value;
+        Write(key, nlohmann::json(value));
     }
 
     auto Get(std::string_view key, auto defaultValue = {}) const
     {
+        std::scoped_lock lock(mutex_);
         return values_.value(key, defaultValue);
     }
 
     bool Has(std::string_view key) const;
     void Erase(std::string_view key);
     void Clear();
+
+private:
+    void Write(std::string_view key, nlohmann::json value);
+
+    void Load();
+    bool Replay();
+    void Flush();
+    bool Compact(const nlohmann::json& snapshot);
+    void Run(std::stop_token stopToken);
 };
\ No newline at end of file
@@ -11,13 +11,16 @@ class SceneManager
 private:
     std::string currentScene_;
     std::optional<std::string> nextScene_;
+    std::optional<std::string> prefetchScene_;
 
 public:
     void ChangeScene(std::string_view name);
     void RestartCurrentScene();
+    void PrefetchScene(std::string_view name);
 
 private:
     friend class Engine;
 
     std::optional<std::string> FetchNextScene();
+    std::optional<std::string> FetchPrefetchScene();
 };
\ No newline at end of file
@@ -0,0 +1,30 @@
+// Copyright (c) 2025 Adel Hales
+
+#pragma once
+
+#include <SFML/Graphics/Shader.hpp>
+
+#include <future>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+class ShaderManager
+{
+private:
+    std::string vertexSource_;
+    std::unordered_map<std::string, std::unique_ptr<sf::Shader>> shaders_;
+    std::future<void> warmup_;
+
+public:
+    ShaderManager();
+
+    sf::Shader& FetchShader(const std::string& fragmentFilename);
+
+private:
+    friend class Engine;
+
+    void FinishWarmup();
+
+    bool Compile(sf::Shader& shader, const std::string& fragmentFilename) const;
+};
\ No newline at end of file
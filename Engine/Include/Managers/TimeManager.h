@@ -5,19 +5,51 @@
 #include <SFML/System/Clock.hpp>
 #include <SFML/System/Time.hpp>
 
+#include <string>
+#include <unordered_map>
+
 class TimeManager
 {
 private:
+    // Sum of the frame deltas a scene was updated with, and the speed it runs at
+    struct SceneClock
+    {
+        sf::Time time;
+        float timeScale = 1;
+    };
+
     sf::Clock clock_;
+    sf::Time realDeltaTime_;
     sf::Time deltaTime_;
     sf::Time previousTime_;
+    int stepCount_ = 1;
+
+    // Kept per scene, so that switching back to a scene resumes its own time and speed
+    std::unordered_map<std::string, SceneClock> sceneClocks_;
+    SceneClock defaultClock_; // Used until the first scene is created
+
+    // Every Cooldown is measured against the current scene's clock
+    static inline SceneClock* sceneClock_ = nullptr;
 
 public:
+    TimeManager();
+
+    // Scaled duration of the current update step, scenes advance their simulation with it
     float GetDeltaTime() const;
+    float GetRealDeltaTime() const;
     float GetElapsedTime() const;
 
+    void SetTimeScale(float scale);
+    float GetTimeScale() const;
+
+    void SetScope(const std::string& scene);
+
+    static sf::Time GetSceneTime();
+
 private:
     friend class Engine;
 
     void Update();
+    int GetStepCount() const;
+    void AdvanceSceneTime();
 };
\ No newline at end of file
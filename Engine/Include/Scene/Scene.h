@@ -16,11 +16,15 @@ public:
     Scene(EngineContext& context) : ctx(context) {}
     virtual ~Scene() = default;
 
+    // Resources are fetched here rather than on construction, by then they are usually prefetched
     virtual void Start() = 0;
     virtual void Update() = 0;
     virtual void Render() const = 0;
+    virtual bool IsOpaque() const { return false; }
+    virtual ResourceManifest GetManifest() const { return {}; }
 
     virtual void OnEvent(const sf::Event&) {};
     virtual void OnPause(bool /* paused */) {}
+    // Resource handles are released here and fetched again on Start, so that other scenes can evict them
     virtual void OnCleanup() {};
 };
\ No newline at end of file
@@ -10,19 +10,42 @@
 #include <cmath>
 #include <optional>
 #include <ranges>
+#include <string_view>
 #include <vector>
 
 #include "Core/EngineConfig.h"
 #include "Utils/Cooldown.h"
 #include "Utils/Log.h"
+#include "Utils/PhysicsBody.h"
+#include "Utils/Pool.h"
 #include "Utils/Verify.h"
 
+inline constexpr unsigned DEFAULT_CHARACTER_SIZE = 30;
+inline constexpr std::string_view PRINTABLE_CHARACTERS = " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~";
+inline constexpr std::string_view DIGIT_CHARACTERS = "0123456789";
+
 inline const sf::Font& GetDefaultFont()
 {
     static const sf::Font font("Content/Fonts/Montserrat.ttf");
     return font;
 }
 
+// Rasterizes glyphs into the default font pages up front, so the first frame showing them does not hitch
+inline void PrewarmGlyphs(unsigned characterSize, std::string_view characters = PRINTABLE_CHARACTERS, float outlineThickness = 0)
+{
+    const sf::Font& font = GetDefaultFont();
+
+    for (char character : characters)
+    {
+        void(font.getGlyph(character, characterSize, false));
+
+        if (outlineThickness != 0)
+        {
+            void(font.getGlyph(character, characterSize, false, outlineThickness));
+        }
+    }
+}
+
 inline bool IsOutsideWindowLeft(const sf::Shape& shape)
 {
     return shape.getPosition().x < shape.getGlobalBounds().size.x / 2;
@@ -43,6 +66,26 @@ inline bool IsOutsideWindowBottom(const sf::Shape& shape)
     return shape.getPosition().y > gConfig.windowSize.y - shape.getGlobalBounds().size.y / 2;
 }
 
+inline bool IsOutsideWindowLeft(const PhysicsBody& body)
+{
+    return body.GetPosition().x < body.GetHalfSize().x;
+}
+
+inline bool IsOutsideWindowRight(const PhysicsBody& body)
+{
+    return body.GetPosition().x > gConfig.windowSize.x - body.GetHalfSize().x;
+}
+
+inline bool IsOutsideWindowTop(const PhysicsBody& body)
+{
+    return body.GetPosition().y < body.GetHalfSize().y;
+}
+
+inline bool IsOutsideWindowBottom(const PhysicsBody& body)
+{
+    return body.GetPosition().y > gConfig.windowSize.y - body.GetHalfSize().y;
+}
+
 inline bool IsOutsideWindow(sf::Vector2f point)
 {
     return point.x < 0 || point.y < 0 || point.x >= gConfig.windowSize.x || point.y >= gConfig.windowSize.y;
@@ -53,6 +96,11 @@ inline std::optional<sf::FloatRect> Intersects(const sf::Shape& shape1, const sf
     return shape1.getGlobalBounds().findIntersection(shape2.getGlobalBounds());
 }
 
+inline std::optional<sf::FloatRect> Intersects(const sf::Shape& shape, const sf::FloatRect& bounds)
+{
+    return shape.getGlobalBounds().findIntersection(bounds);
+}
+
 inline float DistanceSquared(sf::Vector2f point1, sf::Vector2f point2)
 {
     return (point1 - point2).lengthSquared();
@@ -0,0 +1,46 @@
+// Copyright (c) 2025 Adel Hales
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+// Counting replaces the global operator new and delete, it is compiled in with ARCADE_TRACK_ALLOCATIONS
+enum class AllocationZone
+{
+    Other,
+    Events,
+    Update,
+    Render,
+    Count
+};
+
+struct AllocationCounters
+{
+    std::size_t allocations = 0;
+    std::size_t frees = 0;
+    std::size_t bytes = 0;
+};
+
+namespace Allocation
+{
+    using FrameCounters = std::array<AllocationCounters, (std::size_t)AllocationZone::Count>;
+
+    bool IsTracking();
+
+    // Returns what every thread allocated since the previous call, by the zone the main thread was in
+    FrameCounters FetchFrame();
+
+    class ZoneScope
+    {
+    private:
+        AllocationZone previous_;
+
+    public:
+        explicit ZoneScope(AllocationZone zone);
+        ~ZoneScope();
+
+        ZoneScope(const ZoneScope&) = delete;
+        ZoneScope& operator=(const ZoneScope&) = delete;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Adel Hales
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Utils/MappedFile.h"
+
+// On-disk layout: header, index of entries each followed by its path, then the blobs at aligned offsets
+struct ContentArchiveHeader
+{
+    std::array<char, 4> magic = {'A', 'E', 'P', 'K'};
+    std::uint32_t version = 1;
+    std::uint32_t entryCount = 0;
+    std::uint32_t indexSize = 0;
+};
+
+struct ContentArchiveEntry
+{
+    std::uint64_t offset = 0;
+    std::uint64_t storedSize = 0;
+    std::uint64_t originalSize = 0;
+    std::uint32_t compressed = 0;
+    std::uint32_t pathLength = 0;
+};
+
+inline constexpr std::size_t CONTENT_ARCHIVE_ALIGNMENT = 16;
+
+// Memory an entry is inflated into, tagged with the entry so that only that one reuses it
+struct ContentBuffer
+{
+    std::vector<std::byte> data;
+    std::string path;
+};
+
+class ContentArchive
+{
+private:
+    struct Entry
+    {
+        std::span<const std::byte> data;
+        std::size_t originalSize;
+        bool compressed;
+    };
+
+    MappedFile file_;
+    std::unordered_map<std::string, Entry> entries_;
+
+public:
+    bool Open(const std::filesystem::path& path);
+
+    bool IsOpen() const;
+    bool Contains(const std::string& path) const;
+    std::optional<std::size_t> GetSize(const std::string& path) const;
+
+    // Stored entries point straight into the mapping, compressed ones are inflated into the buffer,
+    // which is reused as is when it was last inflated from the same entry
+    std::optional<std::span<const std::byte>> Read(const std::string& path, ContentBuffer& buffer) const;
+};
\ No newline at end of file
@@ -2,13 +2,16 @@
 
 #pragma once
 
-#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
 
+// Measured on the current scene's clock, so it only advances while its scene is updated
 class Cooldown
 {
 private:
-    sf::Clock timer_;
+    sf::Time startTime_;
+    sf::Time stoppedTime_;
     float duration_;
+    bool running_;
 
 public:
     Cooldown(float duration = 0.f);
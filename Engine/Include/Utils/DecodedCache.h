@@ -0,0 +1,53 @@
+// Copyright (c) 2025 Adel Hales
+
+#pragma once
+
+#include <SFML/Audio/SoundChannel.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+// Decoded data either points into a cache mapping or into a fresh decode, both kept alive by storage
+struct DecodedImage
+{
+    sf::Vector2u size;
+    std::span<const std::uint8_t> pixels;
+    std::shared_ptr<const void> storage;
+};
+
+struct DecodedSound
+{
+    unsigned int channelCount;
+    unsigned int sampleRate;
+    std::vector<sf::SoundChannel> channelMap;
+    std::span<const std::int16_t> samples;
+    std::shared_ptr<const void> storage;
+};
+
+// Keeps decoded RGBA and PCM blobs on disk, one file per asset, invalidated by the source mtime and size
+class DecodedCache
+{
+private:
+    std::filesystem::path directory_;
+
+public:
+    explicit DecodedCache(const std::filesystem::path& directory);
+
+    std::optional<DecodedImage> FindImage(const std::string& key, const std::filesystem::path& source) const;
+    std::optional<DecodedSound> FindSound(const std::string& key, const std::filesystem::path& source) const;
+
+    void StoreImage(const std::string& key, const std::filesystem::path& source, const DecodedImage& image) const;
+    void StoreSound(const std::string& key, const std::filesystem::path& source, const DecodedSound& sound) const;
+
+private:
+    std::filesystem::path GetEntryPath(const std::string& key) const;
+    void Write(const std::string& key, std::span<const std::span<const std::byte>> parts) const;
+
+    static std::optional<std::uint64_t> GetSourceStamp(const std::filesystem::path& source);
+};
\ No newline at end of file
@@ -0,0 +1,46 @@
+// Copyright (c) 2025 Adel Hales
+
+#pragma once
+
+#include <cstddef>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+// Bump allocator released at the start of every frame, for transient containers on the main thread
+class FrameArena : public std::pmr::memory_resource
+{
+private:
+    std::unique_ptr<std::byte[]> buffer_;
+    std::size_t capacity_;
+    std::size_t offset_;
+    std::size_t overflow_;
+    std::size_t peakOverflow_;
+
+    // Frames that outgrow the buffer keep working from the heap until the next reset
+    std::pmr::monotonic_buffer_resource overflowResource_;
+
+public:
+    explicit FrameArena(std::size_t capacity);
+
+    void Reset();
+
+    std::size_t GetUsedSize() const;
+    std::size_t GetCapacity() const;
+
+    template <typename... Args>
+    std::pmr::string Format(std::format_string<Args...> format, Args&&... args)
+    {
+        std::pmr::string text(this);
+        std::format_to(std::back_inserter(text), format, std::forward<Args>(args)...);
+        return text;
+    }
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+};
\ No newline at end of file
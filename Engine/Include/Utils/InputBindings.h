@@ -23,6 +23,11 @@ namespace Input
 
     using Binding = std::variant<Keyboard, Mouse, Gamepad, Axis>;
 
+    // Mappings are cached per gamepad id, refresh one when its device changes
+    void LoadGamepadDatabase();
+    void RefreshGamepad(int id);
+    void ForgetGamepad(int id);
+
     std::optional<int> LogicalToHardware(GamepadButton button, int id);
     std::optional<GamepadButton> HardwareToLogical(int button, int id);
 }
\ No newline at end of file
@@ -0,0 +1,11 @@
+// Copyright (c) 2025 Adel Hales
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// Raw LZ4 block format (no frame header), so that packed entries stay readable by the reference decoder
+std::vector<std::byte> CompressLz4(std::span<const std::byte> source);
+bool DecompressLz4(std::span<const std::byte> source, std::span<std::byte> destination);
\ No newline at end of file
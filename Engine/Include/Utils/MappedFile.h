@@ -0,0 +1,27 @@
+// Copyright (c) 2025 Adel Hales
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+class MappedFile
+{
+private:
+    const std::byte* data_ = nullptr;
+    std::size_t size_ = 0;
+
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const std::filesystem::path& path);
+    void Close();
+
+    bool IsOpen() const;
+    std::span<const std::byte> GetData() const;
+};
\ No newline at end of file
@@ -0,0 +1,72 @@
+// Copyright (c) 2025 Adel Hales
+
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Shape.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cmath>
+#include <optional>
+
+// Axis-aligned box kept next to a shape, so collision checks skip recomputing the SFML transform
+// Moving only shifts the cached box, fit it again after the shape is resized, scaled or rotated off the axes
+class PhysicsBody
+{
+private:
+    sf::Vector2f position_;
+    sf::Vector2f halfSize_;
+    sf::FloatRect bounds_;
+
+public:
+    void Fit(const sf::Shape& shape)
+    {
+        bounds_ = shape.getGlobalBounds();
+        halfSize_ = bounds_.size / 2.f;
+        position_ = bounds_.position + halfSize_;
+    }
+
+    void SetPosition(sf::Vector2f position)
+    {
+        position_ = position;
+        bounds_.position = position - halfSize_;
+    }
+
+    void Move(sf::Vector2f offset)
+    {
+        SetPosition(position_ + offset);
+    }
+
+    void SetHalfSize(sf::Vector2f halfSize)
+    {
+        halfSize_ = halfSize;
+        bounds_ = {position_ - halfSize, halfSize * 2.f};
+    }
+
+    sf::Vector2f GetPosition() const { return position_; }
+    sf::Vector2f GetHalfSize() const { return halfSize_; }
+    const sf::FloatRect& GetBounds() const { return bounds_; }
+};
+
+inline bool Overlaps(const PhysicsBody& body1, const PhysicsBody& body2)
+{
+    const sf::Vector2f distance = body1.GetPosition() - body2.GetPosition();
+    const sf::Vector2f reach = body1.GetHalfSize() + body2.GetHalfSize();
+
+    return std::abs(distance.x) < reach.x && std::abs(distance.y) < reach.y;
+}
+
+inline std::optional<sf::FloatRect> Intersects(const PhysicsBody& body1, const PhysicsBody& body2)
+{
+    return Overlaps(body1, body2) ? body1.GetBounds().findIntersection(body2.GetBounds()) : std::nullopt;
+}
+
+inline std::optional<sf::FloatRect> Intersects(const PhysicsBody& body, const sf::FloatRect& bounds)
+{
+    return body.GetBounds().findIntersection(bounds);
+}
+
+inline bool Contains(const PhysicsBody& body, sf::Vector2f point)
+{
+    return body.GetBounds().contains(point);
+}
\ No newline at end of file
@@ -0,0 +1,151 @@
+// Copyright (c) 2025 Adel Hales
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+struct PoolHandle
+{
+    std::uint32_t index = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t generation = 0;
+
+    bool operator==(const PoolHandle&) const = default;
+};
+
+// Fixed capacity storage kept dense for iteration, removal swaps with the last item so order is not preserved
+// Items are constructed once with the pool and reused as is, so Spawn hands back the previous occupant to overwrite
+template <class T, std::size_t Capacity>
+class Pool
+{
+private:
+    static_assert(Capacity > 0 && Capacity < std::numeric_limits<std::uint32_t>::max(), "Capacity must fit a handle index");
+
+    struct Slot
+    {
+        std::uint32_t dense;
+        std::uint32_t generation;
+        std::uint32_t nextFree;
+    };
+
+    std::array<T, Capacity> items_{};
+    std::array<Slot, Capacity> slots_{};
+    std::array<std::uint32_t, Capacity> owners_{};
+    std::uint32_t size_ = 0;
+    std::uint32_t freeHead_ = 0;
+
+public:
+    Pool()
+    {
+        for (std::uint32_t i = 0; i < Capacity; i++)
+        {
+            slots_[i] = {0, 0, i + 1};
+        }
+    }
+
+    T* Spawn()
+    {
+        if (size_ == Capacity)
+        {
+            return nullptr;
+        }
+
+        const std::uint32_t slot = freeHead_;
+        freeHead_ = slots_[slot].nextFree;
+        slots_[slot].dense = size_;
+        owners_[size_] = slot;
+        return &items_[size_++];
+    }
+
+    void Remove(PoolHandle handle)
+    {
+        if (IsAlive(handle))
+        {
+            RemoveAt(slots_[handle.index].dense);
+        }
+    }
+
+    template <class Predicate>
+    std::size_t RemoveIf(Predicate predicate)
+    {
+        const std::uint32_t size = size_;
+
+        for (std::uint32_t i = 0; i < size_;)
+        {
+            if (predicate(std::as_const(items_[i])))
+            {
+                RemoveAt(i);
+            }
+            else
+            {
+                i++;
+            }
+        }
+
+        return size - size_;
+    }
+
+    void Clear()
+    {
+        while (size_ > 0)
+        {
+            RemoveAt(size_ - 1);
+        }
+    }
+
+    PoolHandle GetHandle(const T& item) const
+    {
+        const std::uint32_t slot = owners_[&item - items_.data()];
+        return {slot, slots_[slot].generation};
+    }
+
+    bool IsAlive(PoolHandle handle) const
+    {
+        return handle.index < Capacity && slots_[handle.index].generation == handle.generation && slots_[handle.index].dense < size_ && owners_[slots_[handle.index].dense] == handle.index;
+    }
+
+    T* Get(PoolHandle handle)
+    {
+        return IsAlive(handle) ? &items_[slots_[handle.index].dense] : nullptr;
+    }
+
+    const T* Get(PoolHandle handle) const
+    {
+        return IsAlive(handle) ? &items_[slots_[handle.index].dense] : nullptr;
+    }
+
+    T& operator[](std::size_t index) { return items_[index]; }
+    const T& operator[](std::size_t index) const { return items_[index]; }
+
+    std::size_t GetSize() const { return size_; }
+    std::size_t GetCapacity() const { return Capacity; }
+    bool IsEmpty() const { return size_ == 0; }
+    bool IsFull() const { return size_ == Capacity; }
+
+    T* begin() { return items_.data(); }
+    T* end() { return items_.data() + size_; }
+    const T* begin() const { return items_.data(); }
+    const T* end() const { return items_.data() + size_; }
+
+private:
+    void RemoveAt(std::uint32_t dense)
+    {
+        const std::uint32_t slot = owners_[dense];
+        const std::uint32_t last = --size_;
+
+        // Swapping rather than moving keeps the removed item's buffers around for the next spawn
+        if (dense != last)
+        {
+            std::swap(items_[dense], items_[last]);
+            owners_[dense] = owners_[last];
+            slots_[owners_[dense]].dense = dense;
+        }
+
+        slots_[slot].generation++;
+        slots_[slot].nextFree = freeHead_;
+        freeHead_ = slot;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,68 @@
+// Copyright (c) 2025 Adel Hales
+
+#pragma once
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/System/Angle.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+// xoshiro256** generator, usable with the standard algorithms as a uniform random bit generator
+class Random
+{
+private:
+    std::array<std::uint64_t, 4> state_;
+
+public:
+    using result_type = std::uint64_t;
+
+    explicit Random(std::uint64_t seed = 0);
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()()
+    {
+        const std::uint64_t result = RotateLeft(state_[1] * 5, 7) * 9;
+        const std::uint64_t t = state_[1] << 17;
+
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = RotateLeft(state_[3], 45);
+
+        return result;
+    }
+
+    // Advance by 2^128 and 2^192 draws, sequences started this way never overlap
+    void Jump();
+    void LongJump();
+
+    // Returns a generator for a worker and jumps this one past everything the worker can draw
+    Random Split();
+
+    int Int(int min, int max);
+    float Float(float min, float max);
+    bool Bool(float probability = 0.5f);
+
+    sf::Vector2f Position(sf::Vector2f min, sf::Vector2f max);
+    sf::Angle Angle(sf::Angle min, sf::Angle max);
+    sf::Color Color(sf::Color min, sf::Color max);
+
+    void Fill(std::span<int> values, int min, int max);
+    void Fill(std::span<float> values, float min, float max);
+
+private:
+    static std::uint64_t RotateLeft(std::uint64_t value, int shift)
+    {
+        return (value << shift) | (value >> (64 - shift));
+    }
+
+    void Jump(const std::array<std::uint64_t, 4>& polynomial);
+};
\ No newline at end of file
@@ -0,0 +1,49 @@
+// Copyright (c) 2025 Adel Hales
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+
+// Lock-free ring for exactly one producer thread and one consumer thread
+template <class T, std::size_t Capacity>
+class SpscQueue
+{
+private:
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    std::array<T, Capacity> items_{};
+    std::atomic<std::size_t> head_ = 0;
+    std::atomic<std::size_t> tail_ = 0;
+
+public:
+    bool Push(const T& item)
+    {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+
+        if (tail - head_.load(std::memory_order_acquire) == Capacity)
+        {
+            return false;
+        }
+
+        items_[tail & (Capacity - 1)] = item;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::optional<T> Pop()
+    {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+
+        if (head == tail_.load(std::memory_order_acquire))
+        {
+            return std::nullopt;
+        }
+
+        T item = items_[head & (Capacity - 1)];
+        head_.store(head + 1, std::memory_order_release);
+        return item;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,126 @@
+// Copyright (c) 2025 Adel Hales
+
+#include "Core/AllocationMonitor.h"
+
+#include <magic_enum/magic_enum.hpp>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <fstream>
+
+#include "Core/EngineConfig.h"
+#include "Utils/Log.h"
+
+namespace
+{
+    const std::string REPORT_PATH = "AllocationReport.json";
+}
+
+AllocationMonitor::AllocationMonitor() :
+    scene_(nullptr),
+    sceneFrames_(0)
+{
+    if (Allocation::IsTracking())
+    {
+        LOG_INFO("Allocation tracking enabled, warm-up is {} frames", gConfig.allocationWarmup);
+    }
+}
+
+AllocationMonitor::~AllocationMonitor()
+{
+    if (Allocation::IsTracking())
+    {
+        WriteReport();
+    }
+}
+
+void AllocationMonitor::SetScene(const std::string& name)
+{
+    // The frame in progress still belongs to the scene that was running, the new one is tagged once it ends
+    nextScene_ = name;
+}
+
+void AllocationMonitor::FinishFrame()
+{
+    const Allocation::FrameCounters frame = Allocation::FetchFrame();
+
+    if (Allocation::IsTracking() && scene_)
+    {
+        CountFrame(frame);
+    }
+
+    if (nextScene_)
+    {
+        scene_ = &scenes_[*nextScene_];
+        sceneName_ = std::move(*nextScene_);
+        sceneFrames_ = 0;
+        nextScene_.reset();
+    }
+}
+
+void AllocationMonitor::CountFrame(const Allocation::FrameCounters& frame)
+{
+    scene_->frames++;
+    sceneFrames_++;
+
+    for (std::size_t i = 0; i < frame.size(); i++)
+    {
+        scene_->total[i].allocations += frame[i].allocations;
+        scene_->total[i].frees += frame[i].frees;
+        scene_->total[i].bytes += frame[i].bytes;
+    }
+
+    const AllocationCounters& update = frame[(std::size_t)AllocationZone::Update];
+
+    if (update.allocations > scene_->peakUpdate.allocations)
+    {
+        scene_->peakUpdate = update;
+    }
+
+    // Past warm-up the update loop is expected to run out of preallocated storage
+    if (sceneFrames_ > gConfig.allocationWarmup && update.allocations > 0)
+    {
+        if (scene_->steadyUpdateFrames++ == 0)
+        {
+            LOG_WARNING("Scene {} allocated {} times ({} bytes) in Update after warm-up", sceneName_, update.allocations, update.bytes);
+        }
+    }
+}
+
+void AllocationMonitor::WriteReport() const
+{
+    nlohmann::json report;
+
+    for (const auto& [name, scene] : scenes_)
+    {
+        auto& entry = report["scenes"][name];
+        entry["frames"] = scene.frames;
+        entry["steadyUpdateFrames"] = scene.steadyUpdateFrames;
+        entry["steadyState"] = scene.steadyUpdateFrames == 0;
+        entry["peakUpdate"] = {{"allocations", scene.peakUpdate.allocations}, {"bytes", scene.peakUpdate.bytes}};
+
+        const double frames = (double)std::max<std::size_t>(scene.frames, 1);
+
+        for (const auto& [zone, zoneName] : magic_enum::enum_entries<AllocationZone>())
+        {
+            if (zone == AllocationZone::Count)
+            {
+                continue;
+            }
+
+            const AllocationCounters& total = scene.total[(std::size_t)zone];
+            entry["zones"][std::string(zoneName)] = {
+                {"allocations", total.allocations},
+                {"frees", total.frees},
+                {"bytes", total.bytes},
+                {"allocationsPerFrame", total.allocations / frames},
+                {"bytesPerFrame", total.bytes / frames}
+            };
+        }
+    }
+
+    std::ofstream file(REPORT_PATH);
+    file << report.dump(4);
+
+    LOG_INFO("Allocation report written to {}", REPORT_PATH);
+}
\ No newline at end of file
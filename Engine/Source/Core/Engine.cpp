@@ -24,7 +24,16 @@ Engine::Engine() :
     LOG_INFO("Window created");
 
     context_.audio.SetGlobalVolume(gConfig.globalVolume);
+
+    Input::LoadGamepadDatabase();
+
+    // Scenes prewarm their own sizes when created, this covers every text left at the default size
+    PrewarmGlyphs(DEFAULT_CHARACTER_SIZE);
+
     context_.scenes.ChangeScene("Menu");
+
+    // Shaders were compiling in the background while the scenes were created
+    context_.shaders.FinishWarmup();
 }
 
 bool Engine::IsRunning() const
@@ -39,11 +48,22 @@ bool Engine::HasFocus() const
 
 void Engine::ProcessEvents()
 {
+    // A frame starts here, nothing allocated from the arena outlives the previous one
+    context_.arena.Reset();
+    allocations_.FinishFrame();
+
     if (const auto nextScene = context_.scenes.FetchNextScene())
     {
         EventSceneChange(*nextScene);
     }
 
+    if (const auto prefetchScene = context_.scenes.FetchPrefetchScene())
+    {
+        EventScenePrefetch(*prefetchScene);
+    }
+
+    const Allocation::ZoneScope zone(AllocationZone::Events);
+
     while (const auto event = window_.pollEvent())
     {
         event->visit(EngineVisitor{*this});
@@ -64,11 +84,33 @@ void Engine::ProcessEvents()
 void Engine::Update()
 {
     context_.time.Update();
-    context_.cursor.Update(context_.time.GetDeltaTime());
+    context_.cursor.Update(context_.time.GetRealDeltaTime());
+    context_.resources.Update();
+    context_.input.Update(context_.time.GetRealDeltaTime());
 
-    if (!overlay_.IsVisible())
+    if (!overlay_.IsVisible() && !context_.resources.IsLoading())
     {
-        currentScene_->Update();
+        // Steps past the simulation budget are dropped, fast-forward slows down instead of stalling the frame
+        const sf::Clock budget;
+        const int stepCount = context_.time.GetStepCount();
+        const Allocation::ZoneScope zone(AllocationZone::Update);
+
+        for (int step = 0; step < stepCount; step++)
+        {
+            if (step > 0)
+            {
+                if (budget.getElapsedTime() > gConfig.simulationBudget)
+                {
+                    break;
+                }
+
+                // Input edges and events belong to the first step only
+                context_.input.FinishStep();
+            }
+
+            context_.time.AdvanceSceneTime();
+            currentScene_->Update();
+        }
     }
 }
 
@@ -76,9 +118,18 @@ void Engine::Render()
 {
     window_.clear();
 
-    context_.renderer.BeginDrawing();
-    currentScene_->Render();
-    window_.draw(sf::Sprite(context_.renderer.FinishDrawing()));
+    if (context_.resources.IsLoading())
+    {
+        loadingScreen_.Render(window_, context_.resources.GetLoadingProgress());
+    }
+    else
+    {
+        const Allocation::ZoneScope zone(AllocationZone::Render);
+
+        context_.renderer.BeginDrawing(currentScene_->IsOpaque());
+        currentScene_->Render();
+        context_.renderer.FinishDrawing(window_);
+    }
 
     context_.gui.Render();
     context_.cursor.Render();
@@ -114,13 +165,22 @@ void Engine::EventWindowScreenshot() const
     context_.screenshot.Take();
 }
 
+void Engine::EventOverdrawToggle()
+{
+    context_.renderer.SetOverdrawVisible(!context_.renderer.IsOverdrawVisible());
+
+    LOG_INFO(context_.renderer.IsOverdrawVisible() ? "Overdraw heat map shown" : "Overdraw heat map hidden");
+}
+
 void Engine::EventGamepadConnected(int id)
 {
+    Input::RefreshGamepad(id);
     LOG_INFO("Gamepad {} connected", id);
 }
 
 void Engine::EventGamepadDisconnected(int id)
 {
+    Input::ForgetGamepad(id);
     LOG_INFO("Gamepad {} disconnected", id);
 }
 
@@ -131,15 +191,32 @@ void Engine::EventSceneChange(const std::string& name)
 
     if (currentScene_)
     {
+        // Whatever the scene still holds after its cleanup cannot be evicted while the next one runs
+        const std::size_t heldSize = context_.resources.GetHeldMemoryUsage();
         currentScene_->OnCleanup();
+        const std::size_t releasedSize = heldSize - context_.resources.GetHeldMemoryUsage();
+
+        LOG_INFO("Scene cleanup released {} KB of resources, {} KB still held", releasedSize / 1024, (heldSize - releasedSize) / 1024);
     }
 
     context_.input.Clear();
+    context_.resources.SetScope(name);
+    context_.audio.SetScope(name);
+    context_.time.SetScope(name);
+    allocations_.SetScene(name);
 
     currentScene_ = nextScene;
     currentScene_->Start();
 }
 
+void Engine::EventScenePrefetch(const std::string& name)
+{
+    if (const auto it = scenes_.find(name); it != scenes_.end())
+    {
+        context_.resources.Prefetch(name, it->second->GetManifest());
+    }
+}
+
 void Engine::EventSceneRestart()
 {
     overlay_.SetVisible(false);
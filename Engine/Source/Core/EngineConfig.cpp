@@ -13,14 +13,27 @@ EngineConfig::EngineConfig()
     assert(file);
 
     nlohmann::json json = nlohmann::json::parse(file);
-    windowTitle      = json["windowTitle"];
-    windowSize       ={json["windowSize"][0], json["windowSize"][1]};
-    disableSfmlLogs  = json["disableSfmlLogs"];
-    maximumDeltaTime = sf::seconds(json["maximumDeltaTime"]);
-    globalVolume     = json["globalVolume"];
-    backgroundColor  ={json["backgroundColor"][0], json["backgroundColor"][1], json["backgroundColor"][2]};
-    cursorRadius     = json["cursorRadius"];
-    cursorSpeed      = json["cursorSpeed"];
-    cursorColor      ={json["cursorColor"][0], json["cursorColor"][1], json["cursorColor"][2]};
-    joystickDeadzone = json["joystickDeadzone"];
+    windowTitle          = json["windowTitle"];
+    windowSize           ={json["windowSize"][0], json["windowSize"][1]};
+    disableSfmlLogs      = json["disableSfmlLogs"];
+    maximumDeltaTime     = sf::seconds(json["maximumDeltaTime"]);
+    globalVolume         = json["globalVolume"];
+    backgroundColor      ={json["backgroundColor"][0], json["backgroundColor"][1], json["backgroundColor"][2]};
+    cursorRadius         = json["cursorRadius"];
+    cursorSpeed          = json["cursorSpeed"];
+    cursorColor          ={json["cursorColor"][0], json["cursorColor"][1], json["cursorColor"][2]};
+    joystickDeadzone     = json["joystickDeadzone"];
+    resourceUploadBudget = sf::seconds(json["resourceUploadBudget"]);
+    textureMemoryBudget  = json["textureMemoryBudget"].get<std::size_t>() << 20;
+    resourceMemoryBudget = json["resourceMemoryBudget"].get<std::size_t>() << 20;
+    voiceCount           = json["voiceCount"];
+    soundCullDistance    = json["soundCullDistance"];
+    soundCullVolume      = json["soundCullVolume"];
+    saveInterval         = sf::seconds(json["saveInterval"]);
+    saveBinary           = json["saveBinary"];
+    inputSampleRate      = json["inputSampleRate"];
+    simulationBudget     = sf::seconds(json["simulationBudget"]);
+    randomSeed           = json["randomSeed"];
+    frameArenaSize       = json["frameArenaSize"].get<std::size_t>() << 10;
+    allocationWarmup     = json["allocationWarmup"];
 }
\ No newline at end of file
@@ -52,6 +52,10 @@ void EngineVisitor::operator()(const sf::Event::KeyPressed& key)
     {
         engine.EventWindowScreenshot();
     }
+    else if (key.scancode == sf::Keyboard::Scan::F3)
+    {
+        engine.EventOverdrawToggle();
+    }
 }
 
 void EngineVisitor::operator()(const sf::Event::JoystickButtonPressed& joystick)
@@ -0,0 +1,40 @@
+// Copyright (c) 2025 Adel Hales
+
+#include "Core/LoadingScreen.h"
+
+#include <format>
+
+#include "Core/EngineConfig.h"
+#include "Scene/SceneUtils.h"
+
+LoadingScreen::LoadingScreen() :
+    text_(GetDefaultFont())
+{
+    background_.setSize(gConfig.windowSize);
+    background_.setFillColor(sf::Color::Black);
+
+    bar_.setSize(gConfig.windowSize.componentWiseMul({0.60f, 0.04f}));
+    bar_.setOrigin(bar_.getGeometricCenter());
+    bar_.setPosition(gConfig.windowSize / 2.f);
+    bar_.setFillColor(sf::Color::Transparent);
+    bar_.setOutlineColor(gConfig.cursorColor);
+    bar_.setOutlineThickness(2);
+
+    progress_.setPosition(bar_.getPosition() - bar_.getSize() / 2.f);
+    progress_.setFillColor(gConfig.cursorColor);
+
+    text_.setPosition(bar_.getPosition() - sf::Vector2f(0, bar_.getSize().y * 2));
+}
+
+void LoadingScreen::Render(sf::RenderWindow& window, float progress)
+{
+    progress_.setSize(bar_.getSize().componentWiseMul({progress, 1}));
+
+    text_.setString(std::format("Loading {}%", int(progress * 100)));
+    text_.setOrigin(text_.getLocalBounds().getCenter());
+
+    window.draw(background_);
+    window.draw(bar_);
+    window.draw(progress_);
+    window.draw(text_);
+}
\ No newline at end of file
@@ -2,21 +2,16 @@
 
 #include "Graphics/AnimatedShape.h"
 
-#include <algorithm>
-
-void AnimatedShape::Start(const AnimatedShapeConfig& config)
+void AnimatedShape::Start(const AnimationClip& clip)
 {
-    config_ = config;
-    setTexture(config_.texture);
+    clip_ = &clip;
+    setTexture(&clip_->GetTexture());
 
-    currentFrame_ = {};
+    row_ = 0;
+    frame_ = clip_->GetRowFirstFrame(row_);
     elapsedTime_ = 0;
 
-    const int cols = *std::ranges::max_element(config_.frameCountPerRow);
-    const int rows = (int)config_.frameCountPerRow.size();
-
-    frameSize_ = sf::Vector2i(config_.texture->getSize()).componentWiseDiv({cols, rows});
-    setTextureRect({{}, frameSize_});
+    setTextureRect(clip_->GetFrameRect(frame_));
 }
 
 bool AnimatedShape::Update(float deltaTime)
@@ -27,12 +22,12 @@ bool AnimatedShape::Update(float deltaTime)
     }
 
     elapsedTime_ += deltaTime;
-    if (elapsedTime_ >= config_.frameDuration)
+    if (elapsedTime_ >= clip_->GetFrameDuration())
     {
-        currentFrame_.x = (currentFrame_.x + 1) % config_.frameCountPerRow[currentFrame_.y];
-        setTextureRect({currentFrame_.componentWiseMul(frameSize_), frameSize_});
+        frame_ = clip_->GetNextFrame(frame_);
+        setTextureRect(clip_->GetFrameRect(frame_));
 
-        elapsedTime_ -= config_.frameDuration;
+        elapsedTime_ -= clip_->GetFrameDuration();
         return true;
     }
 
@@ -41,10 +36,11 @@ bool AnimatedShape::Update(float deltaTime)
 
 void AnimatedShape::SetRow(int rowIndex)
 {
-    if (currentFrame_.y != rowIndex)
+    if (row_ != rowIndex)
     {
-        currentFrame_ = {0, rowIndex};
-        setTextureRect({currentFrame_.componentWiseMul(frameSize_), frameSize_});
+        row_ = rowIndex;
+        frame_ = clip_->GetRowFirstFrame(row_);
+        setTextureRect(clip_->GetFrameRect(frame_));
 
         elapsedTime_ = 0;
     }
@@ -52,5 +48,5 @@ void AnimatedShape::SetRow(int rowIndex)
 
 bool AnimatedShape::IsFinished() const
 {
-    return !config_.looping && currentFrame_.x == config_.frameCountPerRow[currentFrame_.y] - 1;
+    return clip_->IsFinished(frame_);
 }
\ No newline at end of file
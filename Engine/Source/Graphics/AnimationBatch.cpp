@@ -0,0 +1,103 @@
+// Copyright (c) 2025 Adel Hales
+
+#include "Graphics/AnimationBatch.h"
+
+#include <algorithm>
+
+AnimationBatch::AnimationBatch(const AnimationClip& clip) :
+    clip_(clip)
+{
+}
+
+void AnimationBatch::Add(sf::Vector2f center, sf::Vector2f size, sf::Color color)
+{
+    static const sf::Vector2f offsets[] = { {0,0}, {1,0}, {0,1}, {1,0}, {1,1}, {0,1} };
+
+    frames_.push_back(clip_.GetRowFirstFrame(0));
+    elapsedTimes_.push_back(0);
+
+    const sf::Vector2f topLeft = center - size / 2.f;
+
+    for (const sf::Vector2f& offset : offsets)
+    {
+        vertices_.push_back({topLeft + offset.componentWiseMul(size), color, {}});
+    }
+
+    WriteTexCoords(frames_.size() - 1);
+}
+
+void AnimationBatch::Update(float deltaTime)
+{
+    const float frameDuration = clip_.GetFrameDuration();
+
+    for (std::size_t i = 0; i < frames_.size(); i++)
+    {
+        if (clip_.IsFinished(frames_[i]))
+        {
+            continue;
+        }
+
+        elapsedTimes_[i] += deltaTime;
+        if (elapsedTimes_[i] >= frameDuration)
+        {
+            frames_[i] = clip_.GetNextFrame(frames_[i]);
+            elapsedTimes_[i] -= frameDuration;
+
+            WriteTexCoords(i);
+        }
+    }
+}
+
+void AnimationBatch::RemoveFinished()
+{
+    // Swap-remove keeps the arrays dense without shifting the tail
+    for (std::size_t i = 0; i < frames_.size();)
+    {
+        if (!clip_.IsFinished(frames_[i]))
+        {
+            i++;
+            continue;
+        }
+
+        const std::size_t last = frames_.size() - 1;
+
+        frames_[i] = frames_[last];
+        elapsedTimes_[i] = elapsedTimes_[last];
+        std::copy_n(vertices_.begin() + last * 6, 6, vertices_.begin() + i * 6);
+
+        frames_.pop_back();
+        elapsedTimes_.pop_back();
+        vertices_.resize(vertices_.size() - 6);
+    }
+}
+
+void AnimationBatch::Clear()
+{
+    frames_.clear();
+    elapsedTimes_.clear();
+    vertices_.clear();
+}
+
+std::size_t AnimationBatch::GetCount() const
+{
+    return frames_.size();
+}
+
+void AnimationBatch::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    if (!vertices_.empty())
+    {
+        states.texture = &clip_.GetTexture();
+        target.draw(vertices_.data(), vertices_.size(), sf::PrimitiveType::Triangles, states);
+    }
+}
+
+void AnimationBatch::WriteTexCoords(std::size_t index)
+{
+    const auto& texCoords = clip_.GetFrameTexCoords(frames_[index]);
+
+    for (std::size_t i = 0; i < texCoords.size(); i++)
+    {
+        vertices_[index * 6 + i].texCoords = texCoords[i];
+    }
+}
\ No newline at end of file
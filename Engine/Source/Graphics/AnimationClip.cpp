@@ -0,0 +1,79 @@
+// Copyright (c) 2025 Adel Hales
+
+#include "Graphics/AnimationClip.h"
+
+#include <algorithm>
+#include <cassert>
+
+AnimationClip::AnimationClip(const sf::Texture& texture, std::span<const int> frameCountPerRow,
+                             float frameDuration, bool looping) :
+    texture_(texture),
+    frameDuration_(frameDuration),
+    looping_(looping)
+{
+    const int cols = *std::ranges::max_element(frameCountPerRow);
+    const int rows = (int)frameCountPerRow.size();
+
+    const sf::Vector2i frameSize = sf::Vector2i(texture_.getSize()).componentWiseDiv({cols, rows});
+
+    // Two triangles per quad, matching the vertex order of the batches
+    static const sf::Vector2i offsets[] = { {0,0}, {1,0}, {0,1}, {1,0}, {1,1}, {0,1} };
+
+    for (int row = 0; row < rows; row++)
+    {
+        const int firstFrame = (int)rects_.size();
+        rowFirstFrames_.push_back(firstFrame);
+
+        for (int col = 0; col < frameCountPerRow[row]; col++)
+        {
+            const sf::Vector2i position = sf::Vector2i(col, row).componentWiseMul(frameSize);
+            rects_.emplace_back(position, frameSize);
+
+            auto& texCoords = texCoords_.emplace_back();
+            for (int i = 0; i < 6; i++)
+            {
+                texCoords[i] = sf::Vector2f(position + offsets[i].componentWiseMul(frameSize));
+            }
+
+            const bool lastFrame = (col == frameCountPerRow[row] - 1);
+            const int currentFrame = firstFrame + col;
+            nextFrames_.push_back(!lastFrame ? currentFrame + 1 : looping_ ? firstFrame : currentFrame);
+        }
+    }
+}
+
+const sf::Texture& AnimationClip::GetTexture() const
+{
+    return texture_;
+}
+
+float AnimationClip::GetFrameDuration() const
+{
+    return frameDuration_;
+}
+
+int AnimationClip::GetRowFirstFrame(int rowIndex) const
+{
+    assert(rowIndex >= 0 && rowIndex < (int)rowFirstFrames_.size());
+    return rowFirstFrames_[rowIndex];
+}
+
+int AnimationClip::GetNextFrame(int frame) const
+{
+    return nextFrames_[frame];
+}
+
+bool AnimationClip::IsFinished(int frame) const
+{
+    return !looping_ && nextFrames_[frame] == frame;
+}
+
+const sf::IntRect& AnimationClip::GetFrameRect(int frame) const
+{
+    return rects_[frame];
+}
+
+const std::array<sf::Vector2f, 6>& AnimationClip::GetFrameTexCoords(int frame) const
+{
+    return texCoords_[frame];
+}
\ No newline at end of file
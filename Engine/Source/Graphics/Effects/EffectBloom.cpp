@@ -4,48 +4,45 @@
 
 #include <SFML/Graphics/Sprite.hpp>
 
-#include <string>
-
 #include "Core/EngineConfig.h"
-#include "Utils/Verify.h"
 
-EffectBloom::EffectBloom()
+EffectBloom::EffectBloom(ShaderManager& shaders, RenderTargetPool& targets) :
+    downsampleShader_(shaders.FetchShader("Downsample.frag")),
+    blurShader_(shaders.FetchShader("Blur.frag")),
+    additiveShader_(shaders.FetchShader("Additive.frag")),
+    targets_(targets)
 {
-    const std::string shadersPath  = "Content/Shaders/";
-    const std::string vertexShader = shadersPath + "Default.vert";
-
-    VERIFY(downsampleShader_.loadFromFile(vertexShader, shadersPath + "Downsample.frag"));
-    VERIFY(blurShader_.      loadFromFile(vertexShader, shadersPath + "Blur.frag"));
-    VERIFY(additiveShader_.  loadFromFile(vertexShader, shadersPath + "Additive.frag"));
-
-    // Half-size ping-pong textures for faster and smoother blur
-    for (sf::RenderTexture& texture : textures_)
-    {
-        VERIFY(texture.resize(sf::Vector2u(gConfig.windowSize / 2.f)));
-    }
 }
 
 void EffectBloom::Apply(const sf::Texture& input, sf::RenderTarget& output)
 {
+    // Half-size ping-pong textures for faster and smoother blur, borrowed for this pass only
+    const sf::Vector2u halfSize(gConfig.windowSize / 2.f);
+    sf::RenderTexture& first  = targets_.Acquire(halfSize);
+    sf::RenderTexture& second = targets_.Acquire(halfSize);
+
     // 1. Downsample to reduce input resolution before blur
     downsampleShader_.setUniform("sourceTexture", input);
     downsampleShader_.setUniform("texelSize", sf::Vector2f(1.f / input.getSize().x, 1.f / input.getSize().y));
-    Render(downsampleShader_, textures_[0]);
+    Render(downsampleShader_, first);
 
     // 2. Vertical gaussian blur to spread brightness downward
-    blurShader_.setUniform("sourceTexture", textures_[0].getTexture());
-    blurShader_.setUniform("texelSize", sf::Vector2f(0, 1.f / textures_[0].getSize().y));
-    Render(blurShader_, textures_[1]);
+    blurShader_.setUniform("sourceTexture", first.getTexture());
+    blurShader_.setUniform("texelSize", sf::Vector2f(0, 1.f / first.getSize().y));
+    Render(blurShader_, second);
 
     // 3. Horizontal gaussian blur to spread brightness sideways
-    blurShader_.setUniform("sourceTexture", textures_[1].getTexture());
-    blurShader_.setUniform("texelSize", sf::Vector2f(1.f / textures_[1].getSize().x, 0));
-    Render(blurShader_, textures_[0]);
+    blurShader_.setUniform("sourceTexture", second.getTexture());
+    blurShader_.setUniform("texelSize", sf::Vector2f(1.f / second.getSize().x, 0));
+    Render(blurShader_, first);
 
     // 4. Add bloom on top of original image
     additiveShader_.setUniform("sourceTexture", sf::Shader::CurrentTexture);
-    additiveShader_.setUniform("bloomTexture", textures_[0].getTexture());
+    additiveShader_.setUniform("bloomTexture", first.getTexture());
     output.draw(sf::Sprite(input), &additiveShader_);
+
+    targets_.Release(first);
+    targets_.Release(second);
 }
 
 void EffectBloom::Render(const sf::Shader& shader, sf::RenderTexture& output)
@@ -5,11 +5,9 @@
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/System/Time.hpp>
 
-#include "Utils/Verify.h"
-
-EffectMonitor::EffectMonitor()
+EffectMonitor::EffectMonitor(ShaderManager& shaders) :
+    shader_(shaders.FetchShader("Monitor.frag"))
 {
-    VERIFY(shader_.loadFromFile("Content/Shaders/Monitor.frag", sf::Shader::Type::Fragment));
 }
 
 void EffectMonitor::Apply(const sf::Texture& input, sf::RenderTarget& output)
@@ -0,0 +1,37 @@
+// Copyright (c) 2025 Adel Hales
+
+#include "Graphics/Mesh.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <ranges>
+
+Mesh::Mesh(std::span<const sf::Vector2f> outline)
+{
+    assert(outline.size() >= 3);
+
+    // Fan around the centroid like sf::ConvexShape, which also covers star-shaped outlines
+    const sf::Vector2f center = std::accumulate(outline.begin(), outline.end(), sf::Vector2f()) / (float)outline.size();
+
+    for (std::size_t i = 0; i < outline.size(); i++)
+    {
+        triangles_.push_back(center);
+        triangles_.push_back(outline[i]);
+        triangles_.push_back(outline[(i + 1) % outline.size()]);
+    }
+
+    const auto [minX, maxX] = std::ranges::minmax(outline | std::views::transform(&sf::Vector2f::x));
+    const auto [minY, maxY] = std::ranges::minmax(outline | std::views::transform(&sf::Vector2f::y));
+    bounds_ = {{minX, minY}, {maxX - minX, maxY - minY}};
+}
+
+std::span<const sf::Vector2f> Mesh::GetTriangles() const
+{
+    return triangles_;
+}
+
+sf::FloatRect Mesh::GetBounds() const
+{
+    return bounds_;
+}
\ No newline at end of file
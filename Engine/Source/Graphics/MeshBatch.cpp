@@ -0,0 +1,29 @@
+// Copyright (c) 2025 Adel Hales
+
+#include "Graphics/MeshBatch.h"
+
+void MeshBatch::Add(const Mesh& mesh, const sf::Transform& transform, sf::Color color)
+{
+    for (const sf::Vector2f& point : mesh.GetTriangles())
+    {
+        vertices_.push_back({transform.transformPoint(point), color, {}});
+    }
+}
+
+void MeshBatch::Clear()
+{
+    vertices_.clear();
+}
+
+std::size_t MeshBatch::GetVertexCount() const
+{
+    return vertices_.size();
+}
+
+void MeshBatch::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    if (!vertices_.empty())
+    {
+        target.draw(vertices_.data(), vertices_.size(), sf::PrimitiveType::Triangles, states);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+// Copyright (c) 2025 Adel Hales
+
+#include "Graphics/RenderTargetPool.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "Utils/Log.h"
+#include "Utils/Verify.h"
+
+sf::RenderTexture& RenderTargetPool::Acquire(sf::Vector2u size, const sf::ContextSettings& settings)
+{
+    const auto found = std::ranges::find_if(entries_, [&](const auto& entry) {
+        return !entry->inUse && IsCompatible(*entry, size, settings);
+    });
+
+    if (found != entries_.end())
+    {
+        (*found)->inUse = true;
+        return (*found)->texture;
+    }
+
+    auto& entry = entries_.emplace_back(std::make_unique<Entry>());
+    VERIFY(entry->texture.resize(size, settings));
+    entry->settings = settings;
+    entry->inUse = true;
+
+    LOG_INFO("Render target created: {}x{} ({} in pool)", size.x, size.y, entries_.size());
+    return entry->texture;
+}
+
+void RenderTargetPool::Release(const sf::RenderTexture& texture)
+{
+    const auto found = std::ranges::find_if(entries_, [&](const auto& entry) {
+        return &entry->texture == &texture;
+    });
+
+    VERIFY(found != entries_.end() && (*found)->inUse);
+    (*found)->inUse = false;
+}
+
+std::size_t RenderTargetPool::GetTargetCount() const
+{
+    return entries_.size();
+}
+
+std::size_t RenderTargetPool::GetMemoryUsage() const
+{
+    // 4 bytes per RGBA pixel, ignoring driver padding and depth/stencil buffers
+    return std::accumulate(entries_.begin(), entries_.end(), std::size_t(0), [](std::size_t total, const auto& entry) {
+        return total + std::size_t(entry->texture.getSize().x) * entry->texture.getSize().y * 4;
+    });
+}
+
+bool RenderTargetPool::IsCompatible(const Entry& entry, sf::Vector2u size, const sf::ContextSettings& settings)
+{
+    return entry.texture.getSize() == size &&
+           entry.settings.depthBits == settings.depthBits &&
+           entry.settings.stencilBits == settings.stencilBits &&
+           entry.settings.antiAliasingLevel == settings.antiAliasingLevel &&
+           entry.settings.sRgbCapable == settings.sRgbCapable;
+}
\ No newline at end of file
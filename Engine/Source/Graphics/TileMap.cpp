@@ -2,65 +2,231 @@
 
 #include "Graphics/TileMap.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <format>
 #include <fstream>
 
 #include "Utils/Log.h"
+#include "Utils/MappedFile.h"
 
-bool TileMap::Init(const std::string& tilesetName, sf::Vector2u tileSize, sf::Vector2u mapSize)
+namespace
 {
-    if (!tileset_.loadFromFile("Content/Textures/" + tilesetName))
+    const std::string LEVELS_PATH = "Content/Levels/";
+    const std::uint64_t MAP_TILE_COUNT_MAX = 1024 * 1024;
+
+    enum class TileMapEncoding : std::uint32_t
     {
-        LOG_ERROR("Failed to load tileset: {}", tilesetName);
-        return false;
+        Raw,
+        Rle
+    };
+
+    // On-disk layout: header followed by the tiles, either packed or as runs of identical tiles
+    struct TileMapHeader
+    {
+        std::array<char, 4> magic = {'A', 'E', 'M', 'P'};
+        std::uint32_t version = 1;
+        std::uint32_t tileSize[2] = {};
+        std::uint32_t mapSize[2] = {};
+        TileMapEncoding encoding = TileMapEncoding::Raw;
+        std::uint32_t dataSize = 0;
+    };
+
+    struct TileRun
+    {
+        std::uint32_t count = 0;
+        Tile tile = TILE_EMPTY;
+    };
+
+    static_assert(sizeof(Tile) == sizeof(std::int32_t));
+
+    const sf::Vector2u OFFSETS[] = { {0,0}, {1,0}, {0,1}, {1,0}, {1,1}, {0,1} };
+
+    std::vector<TileRun> EncodeRuns(const std::vector<Tile>& tiles)
+    {
+        std::vector<TileRun> runs;
+
+        for (Tile tile : tiles)
+        {
+            if (runs.empty() || runs.back().tile != tile)
+            {
+                runs.push_back({0, tile});
+            }
+
+            runs.back().count++;
+        }
+
+        return runs;
     }
 
+    bool DecodeRuns(std::span<const std::byte> data, std::vector<Tile>& tiles)
+    {
+        std::size_t index = 0;
+
+        for (std::size_t position = 0; position + sizeof(TileRun) <= data.size(); position += sizeof(TileRun))
+        {
+            TileRun run;
+            std::memcpy(&run, data.data() + position, sizeof(run));
+
+            if (run.count > tiles.size() - index)
+            {
+                return false;
+            }
+
+            std::fill_n(tiles.begin() + index, run.count, run.tile);
+            index += run.count;
+        }
+
+        return index == tiles.size();
+    }
+}
+
+void TileMap::Init(const sf::Texture& tileset, sf::Vector2u tileSize, sf::Vector2u mapSize)
+{
     vertices_.setPrimitiveType(sf::PrimitiveType::Triangles);
+    tileset_  = &tileset;
     tileSize_ = tileSize;
     mapSize_  = mapSize;
-    gridSize_ = tileset_.getSize().componentWiseDiv(tileSize_);
+    gridSize_ = tileset_->getSize().componentWiseDiv(tileSize_);
 
     Clear();
-
-    return true;
 }
 
 void TileMap::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
-    states.texture = &tileset_;
+    states.texture = tileset_;
     target.draw(vertices_, states);
 }
 
-bool TileMap::LoadFromFile(const std::string& filename, const std::string& tilesetName)
+bool TileMap::LoadFromFile(const std::string& filename, const sf::Texture& tileset)
 {
-    std::ifstream file("Content/Levels/" + filename);
-    if (!file)
+    MappedFile file;
+    if (!file.Open(LEVELS_PATH + filename))
     {
         LOG_ERROR("Failed to open file: {}", filename);
         return false;
     }
 
-    sf::Vector2u tileSize, mapSize;
-    file >> tileSize.x >> tileSize.y >> mapSize.x >> mapSize.y;
+    const auto data = file.GetData();
+    const TileMapHeader expected;
+    TileMapHeader header;
 
-    if (!Init(tilesetName, tileSize, mapSize))
+    if (data.size() < sizeof(header))
     {
+        LOG_ERROR("Invalid tile map: {}", filename);
         return false;
     }
 
-    for (std::size_t i = 0; i < tiles_.size(); i++)
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    if (header.magic != expected.magic || header.version != expected.version || header.dataSize != data.size() - sizeof(header))
     {
-        file >> tiles_[i];
-        SetTile({(int)i % mapSize_.x, (int)i / mapSize_.x}, tiles_[i]);
+        LOG_ERROR("Invalid tile map: {}", filename);
+        return false;
     }
 
+    // Checked before Init, which divides by the tile size and allocates the whole map up front
+    const std::uint64_t tileCount = std::uint64_t(header.mapSize[0]) * header.mapSize[1];
+    const bool isRaw = header.encoding == TileMapEncoding::Raw;
+    const bool isRle = header.encoding == TileMapEncoding::Rle;
+
+    if (header.tileSize[0] == 0 || header.tileSize[1] == 0 || tileCount == 0 || tileCount > MAP_TILE_COUNT_MAX ||
+        (isRaw && tileCount * sizeof(Tile) != header.dataSize) || (!isRaw && !isRle))
+    {
+        LOG_ERROR("Corrupted tile map: {}", filename);
+        return false;
+    }
+
+    Init(tileset, {header.tileSize[0], header.tileSize[1]}, {header.mapSize[0], header.mapSize[1]});
+
+    const auto payload = data.subspan(sizeof(header));
+    bool isValid = true;
+
+    if (isRaw)
+    {
+        std::memcpy(tiles_.data(), payload.data(), payload.size());
+    }
+    else
+    {
+        isValid = DecodeRuns(payload, tiles_);
+    }
+
+    if (!isValid)
+    {
+        LOG_ERROR("Corrupted tile map: {}", filename);
+        Clear();
+        return false;
+    }
+
+    BuildVertices();
+
     return true;
 }
 
 bool TileMap::SaveToFile(const std::string& filename) const
 {
-    std::ofstream file("Content/Levels/" + filename);
+    std::ofstream file(LEVELS_PATH + filename, std::ios::binary);
+    if (!file)
+    {
+        LOG_ERROR("Failed to create file: {}", filename);
+        return false;
+    }
+
+    const auto runs = EncodeRuns(tiles_);
+    const bool useRuns = runs.size() * sizeof(TileRun) < tiles_.size() * sizeof(Tile);
+
+    TileMapHeader header;
+    header.tileSize[0] = tileSize_.x;
+    header.tileSize[1] = tileSize_.y;
+    header.mapSize[0] = mapSize_.x;
+    header.mapSize[1] = mapSize_.y;
+    header.encoding = useRuns ? TileMapEncoding::Rle : TileMapEncoding::Raw;
+    header.dataSize = std::uint32_t(useRuns ? runs.size() * sizeof(TileRun) : tiles_.size() * sizeof(Tile));
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    if (useRuns)
+    {
+        file.write(reinterpret_cast<const char*>(runs.data()), header.dataSize);
+    }
+    else
+    {
+        file.write(reinterpret_cast<const char*>(tiles_.data()), header.dataSize);
+    }
+
+    return bool(file);
+}
+
+bool TileMap::ImportFromText(const std::string& filename, const sf::Texture& tileset)
+{
+    std::ifstream file(LEVELS_PATH + filename);
+    if (!file)
+    {
+        LOG_ERROR("Failed to open file: {}", filename);
+        return false;
+    }
+
+    sf::Vector2u tileSize, mapSize;
+    file >> tileSize.x >> tileSize.y >> mapSize.x >> mapSize.y;
+
+    Init(tileset, tileSize, mapSize);
+
+    for (auto& tile : tiles_)
+    {
+        file >> tile;
+    }
+
+    BuildVertices();
+
+    return true;
+}
+
+bool TileMap::ExportToText(const std::string& filename) const
+{
+    std::ofstream file(LEVELS_PATH + filename);
     if (!file)
     {
         LOG_ERROR("Failed to create file: {}", filename);
@@ -88,8 +254,6 @@ bool TileMap::SetTile(sf::Vector2u position, Tile tile)
     const std::size_t index = position.x + position.y * mapSize_.x;
     tiles_[index] = tile;
 
-    static const sf::Vector2u offsets[] = { {0,0}, {1,0}, {0,1}, {1,0}, {1,1}, {0,1} };
-
     const bool isValid = IsTileValid(tile);
     const sf::Vector2u uv = isValid ? sf::Vector2u(tile % gridSize_.x, tile / gridSize_.x) : sf::Vector2u();
     const sf::Color color = isValid ? sf::Color::White : sf::Color::Transparent;
@@ -97,8 +261,8 @@ bool TileMap::SetTile(sf::Vector2u position, Tile tile)
     for (int i = 0; i < 6; i++)
     {
         sf::Vertex& vertex = vertices_[index * 6 + i];
-        vertex.position = sf::Vector2f((position + offsets[i]).componentWiseMul(tileSize_));
-        vertex.texCoords = sf::Vector2f((uv + offsets[i]).componentWiseMul(tileSize_));
+        vertex.position = sf::Vector2f((position + OFFSETS[i]).componentWiseMul(tileSize_));
+        vertex.texCoords = sf::Vector2f((uv + OFFSETS[i]).componentWiseMul(tileSize_));
         vertex.color = color;
     }
 
@@ -164,5 +328,52 @@ sf::Vector2u TileMap::GetGridSize() const
 
 const sf::Texture& TileMap::GetTexture() const
 {
-    return tileset_;
+    return *tileset_;
+}
+
+void TileMap::BuildVertices()
+{
+    if (tiles_.empty())
+    {
+        return;
+    }
+
+    // Texture corners are computed once per tileset tile rather than once per map tile
+    std::vector<std::array<sf::Vector2f, 6>> texCoords(gridSize_.x * gridSize_.y);
+    std::array<sf::Vector2f, 6> positionOffsets;
+
+    for (std::size_t i = 0; i < 6; i++)
+    {
+        positionOffsets[i] = sf::Vector2f(OFFSETS[i].componentWiseMul(tileSize_));
+    }
+
+    for (std::size_t tile = 0; tile < texCoords.size(); tile++)
+    {
+        const sf::Vector2f uv(sf::Vector2u(unsigned(tile % gridSize_.x), unsigned(tile / gridSize_.x)).componentWiseMul(tileSize_));
+
+        for (std::size_t i = 0; i < 6; i++)
+        {
+            texCoords[tile][i] = uv + positionOffsets[i];
+        }
+    }
+
+    // Single pass in memory order over the tiles, without the per tile bounds checks of SetTile
+    sf::Vertex* vertex = &vertices_[0];
+    const Tile* tile = tiles_.data();
+
+    for (unsigned y = 0; y < mapSize_.y; y++)
+    {
+        for (unsigned x = 0; x < mapSize_.x; x++, tile++, vertex += 6)
+        {
+            const sf::Vector2f position(sf::Vector2u(x, y).componentWiseMul(tileSize_));
+            const bool isValid = IsTileValid(*tile);
+            const auto& uvs = isValid ? texCoords[*tile] : positionOffsets;
+            const sf::Color color = isValid ? sf::Color::White : sf::Color::Transparent;
+
+            for (std::size_t i = 0; i < 6; i++)
+            {
+                vertex[i] = {position + positionOffsets[i], color, uvs[i]};
+            }
+        }
+    }
 }
\ No newline at end of file
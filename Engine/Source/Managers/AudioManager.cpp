@@ -4,6 +4,104 @@
 
 #include <SFML/Audio/Listener.hpp>
 
+#include <algorithm>
+
+#include "Core/EngineConfig.h"
+
+AudioManager::AudioManager()
+{
+    // Voices are created once, playing a sound only rebinds a buffer
+    voices_.reserve(gConfig.voiceCount);
+
+    for (std::size_t i = 0; i < gConfig.voiceCount; i++)
+    {
+        voices_.emplace_back(silence_);
+    }
+}
+
+void AudioManager::Play(const ResourceHandle<sf::SoundBuffer>& buffer, int priority, std::optional<sf::Vector2f> position, float volume)
+{
+    if (!buffer.IsReady() || volume < gConfig.soundCullVolume)
+    {
+        return;
+    }
+
+    if (position)
+    {
+        const sf::Vector3f listener = GetListenerPosition();
+
+        if ((*position - sf::Vector2f(listener.x, listener.y)).length() > gConfig.soundCullDistance)
+        {
+            return;
+        }
+    }
+
+    Voice* voice = FindVoice(priority);
+
+    if (!voice)
+    {
+        return;
+    }
+
+    voice->sound.stop();
+    voice->sound.setBuffer(*buffer);
+    voice->sound.setVolume(volume);
+
+    // Sounds without a position follow the listener, positioned ones keep full volume within half a window
+    voice->sound.setRelativeToListener(!position);
+    voice->sound.setPosition(position ? sf::Vector3f(position->x, position->y, 0) : sf::Vector3f());
+    voice->sound.setMinDistance(gConfig.windowSize.x / 2);
+
+    voice->buffer = buffer;
+    voice->priority = priority;
+    voice->startedAt = playCount_++;
+    voice->scene = scope_;
+    voice->sound.play();
+}
+
+void AudioManager::PauseSounds(bool paused)
+{
+    for (auto& voice : voices_)
+    {
+        if (voice.scene != scope_)
+        {
+            continue;
+        }
+
+        if (paused && voice.sound.getStatus() == sf::Sound::Status::Playing)
+        {
+            voice.sound.pause();
+        }
+        else if (!paused && voice.sound.getStatus() == sf::Sound::Status::Paused)
+        {
+            voice.sound.play();
+        }
+    }
+}
+
+void AudioManager::StopSounds()
+{
+    for (auto& voice : voices_)
+    {
+        if (voice.scene == scope_)
+        {
+            voice.sound.stop();
+        }
+    }
+}
+
+void AudioManager::SetScope(const std::string& scene)
+{
+    scope_ = scene;
+}
+
+std::size_t AudioManager::GetActiveVoiceCount() const
+{
+    return std::ranges::count_if(voices_, [](const Voice& voice) {
+        return voice.sound.getStatus() != sf::Sound::Status::Stopped;
+    });
+}
+
 void AudioManager::SetGlobalVolume(float volume)
 {
     sf::Listener::setGlobalVolume(volume);
@@ -32,4 +130,26 @@ void AudioManager::SetListenerDirection(sf::Vector3f direction)
 sf::Vector3f AudioManager::GetListenerDirection() const
 {
     return sf::Listener::getDirection();
+}
+
+AudioManager::Voice* AudioManager::FindVoice(int priority)
+{
+    Voice* candidate = nullptr;
+
+    for (auto& voice : voices_)
+    {
+        if (voice.sound.getStatus() == sf::Sound::Status::Stopped)
+        {
+            return &voice;
+        }
+
+        // Steal the lowest priority voice, and the oldest one among equals
+        if (!candidate || voice.priority < candidate->priority ||
+            (voice.priority == candidate->priority && voice.startedAt < candidate->startedAt))
+        {
+            candidate = &voice;
+        }
+    }
+
+    return (candidate && candidate->priority <= priority) ? candidate : nullptr;
 }
\ No newline at end of file
@@ -4,44 +4,244 @@
 
 #include <algorithm>
 
+#include "Core/EngineConfig.h"
+#include "Utils/Log.h"
+
+InputManager::InputManager()
+{
+    // Keyboard and mouse state can only be read off the main thread on Windows, Cocoa and X11 expect it on the window's thread
+#ifdef _WIN32
+    if (gConfig.inputSampleRate > 0)
+    {
+        sampler_ = std::jthread([this](std::stop_token stopToken) { Sample(stopToken); });
+    }
+#else
+    if (gConfig.inputSampleRate > 0)
+    {
+        LOG_WARNING("Input sampling is only supported on Windows, falling back to polling once per frame");
+    }
+#endif
+}
+
 void InputManager::Bind(int action, const Input::Binding& binding)
 {
-    bindings_.emplace(action, binding);
+    if (action >= (int)actions_.size())
+    {
+        actions_.resize(action + 1);
+    }
+
+    auto& state = actions_[action];
+    state.bindings.push_back(binding);
+    watchesDirty_ = true;
+
+    // An input still held from the previous scene starts out pressed, so it does not fire JustPressed on the first frame
+    if (Poll(binding))
+    {
+        state.pressed = state.previous = true;
+        state.polledPressed = state.polledPressed || !IsSampled(binding);
+    }
 }
 
 bool InputManager::Pressed(int action) const
 {
-    const auto [first, last] = bindings_.equal_range(action);
+    const Action* state = FindAction(action);
+    return state && state->pressed;
+}
 
-    return std::any_of(first, last, [this](const auto& entry) {
-        return std::visit([this](const auto& binding) {
-            return this->Pressed(binding);
-        }, entry.second);
-    });
+bool InputManager::JustPressed(int action) const
+{
+    const Action* state = FindAction(action);
+    return state && state->pressed && !state->previous;
+}
+
+bool InputManager::JustReleased(int action) const
+{
+    const Action* state = FindAction(action);
+    return state && !state->pressed && state->previous;
+}
+
+float InputManager::GetHeldDuration(int action) const
+{
+    const Action* state = FindAction(action);
+    return state ? state->heldDuration : 0;
+}
+
+const std::vector<InputEvent>& InputManager::GetEvents() const
+{
+    return events_;
 }
 
 void InputManager::Clear()
 {
-    bindings_.clear();
+    actions_.clear();
+    events_.clear();
+    watchesDirty_ = true;
+}
+
+void InputManager::Update(float deltaTime)
+{
+    if (watchesDirty_)
+    {
+        PublishWatches();
+    }
+
+    const auto now = Clock::now();
+    const std::uint64_t version = watchVersion_.load(std::memory_order_relaxed);
+
+    events_.clear();
+
+    while (const auto transition = transitions_.Pop())
+    {
+        // Transitions sampled for the bindings of a previous scene are dropped
+        if (transition->version == version)
+        {
+            // Measured back from the end of the frame so the latest transitions line up with deltaTime
+            const float age = std::chrono::duration<float>(now - transition->time).count();
+            events_.push_back({transition->action, transition->pressed, std::clamp(deltaTime - age, 0.f, deltaTime)});
+        }
+    }
+
+    for (std::size_t i = 0; i < actions_.size(); i++)
+    {
+        auto& action = actions_[i];
+        bool polled = false;
+        bool sampled = false;
+
+        for (const auto& binding : action.bindings)
+        {
+            if (Poll(binding))
+            {
+                (IsSampled(binding) ? sampled : polled) = true;
+            }
+        }
+
+        // Bindings the input thread does not sample report their transitions at the end of the frame
+        if (polled != action.polledPressed)
+        {
+            action.polledPressed = polled;
+            events_.push_back({(int)i, polled, deltaTime});
+        }
+
+        action.previous = action.pressed;
+        action.pressed = polled || sampled;
+        action.heldDuration = action.pressed ? action.heldDuration + deltaTime : 0;
+    }
+
+    std::ranges::stable_sort(events_, {}, &InputEvent::time);
+}
+
+void InputManager::FinishStep()
+{
+    for (auto& action : actions_)
+    {
+        action.previous = action.pressed;
+    }
+
+    events_.clear();
+}
+
+void InputManager::PublishWatches()
+{
+    std::vector<Watch> watches;
+
+    for (std::size_t i = 0; i < actions_.size(); i++)
+    {
+        Watch watch{(int)i, {}};
+
+        std::ranges::copy_if(actions_[i].bindings, std::back_inserter(watch.bindings), [](const Input::Binding& binding) {
+            return std::holds_alternative<Input::Keyboard>(binding) || std::holds_alternative<Input::Mouse>(binding);
+        });
+
+        if (!watch.bindings.empty())
+        {
+            watches.push_back(std::move(watch));
+        }
+    }
+
+    std::scoped_lock lock(watchMutex_);
+    watches_ = std::move(watches);
+    watchVersion_++;
+    watchesDirty_ = false;
+}
+
+void InputManager::Sample(std::stop_token stopToken)
+{
+    const auto period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1 / gConfig.inputSampleRate));
+
+    std::vector<Watch> watches;
+    std::vector<bool> states;
+    std::uint64_t version = 0;
+    auto next = Clock::now();
+
+    while (!stopToken.stop_requested())
+    {
+        if (watchVersion_.load(std::memory_order_acquire) != version)
+        {
+            std::scoped_lock lock(watchMutex_);
+            watches = watches_;
+            version = watchVersion_;
+            states.clear();
+
+            // Seeded like the actions on Bind, so held inputs do not report a press for the new bindings
+            for (const auto& watch : watches)
+            {
+                states.push_back(std::ranges::any_of(watch.bindings, [this](const Input::Binding& binding) { return Poll(binding); }));
+            }
+        }
+
+        const auto now = Clock::now();
+
+        for (std::size_t i = 0; i < watches.size(); i++)
+        {
+            const bool pressed = std::ranges::any_of(watches[i].bindings, [this](const Input::Binding& binding) {
+                return Poll(binding);
+            });
+
+            // A full queue leaves the state untouched, so the transition is retried on the next sample
+            if (pressed != states[i] && transitions_.Push({watches[i].action, pressed, version, now}))
+            {
+                states[i] = pressed;
+            }
+        }
+
+        // Never try to catch up on samples missed while the thread was descheduled
+        next = std::max(next + period, now);
+        std::this_thread::sleep_until(next);
+    }
+}
+
+const InputManager::Action* InputManager::FindAction(int action) const
+{
+    return (action >= 0 && action < (int)actions_.size()) ? &actions_[action] : nullptr;
+}
+
+bool InputManager::IsSampled(const Input::Binding& binding) const
+{
+    return sampler_.joinable() && (std::holds_alternative<Input::Keyboard>(binding) || std::holds_alternative<Input::Mouse>(binding));
+}
+
+bool InputManager::Poll(const Input::Binding& binding) const
+{
+    return std::visit([this](const auto& input) { return this->Poll(input); }, binding);
 }
 
-bool InputManager::Pressed(const Input::Keyboard& binding) const
+bool InputManager::Poll(const Input::Keyboard& binding) const
 {
     return sf::Keyboard::isKeyPressed(binding.key);
 }
 
-bool InputManager::Pressed(const Input::Mouse& binding) const
+bool InputManager::Poll(const Input::Mouse& binding) const
 {
     return sf::Mouse::isButtonPressed(binding.button);
 }
 
-bool InputManager::Pressed(const Input::Gamepad& binding) const
+bool InputManager::Poll(const Input::Gamepad& binding) const
 {
     const auto button = Input::LogicalToHardware(binding.button, binding.id);
     return button ? sf::Joystick::isButtonPressed(binding.id, *button) : false;
 }
 
-bool InputManager::Pressed(const Input::Axis& binding) const
+bool InputManager::Poll(const Input::Axis& binding) const
 {
     const float axis = sf::Joystick::getAxisPosition(binding.id, binding.axis) / 100;
     return (binding.threshold >= 0) ? axis > binding.threshold : axis < binding.threshold;
@@ -2,32 +2,76 @@
 
 #include "Managers/RandomManager.h"
 
+#include <random>
+
+#include "Core/EngineConfig.h"
+#include "Utils/Log.h"
+
+RandomManager::RandomManager()
+{
+    if (gConfig.randomSeed != 0)
+    {
+        Seed(gConfig.randomSeed);
+    }
+    else
+    {
+        std::random_device device;
+        Seed(std::uint64_t(device()) << 32 | device());
+    }
+}
+
+void RandomManager::Seed(std::uint64_t seed)
+{
+    seed_ = seed;
+
+    // Streams are a long jump apart, drawing more from one never shifts the others
+    Random random(seed);
+
+    for (auto& stream : streams_)
+    {
+        stream = random;
+        random.LongJump();
+    }
+
+    LOG_INFO("Random seed: {}", seed);
+}
+
+std::uint64_t RandomManager::GetSeed() const
+{
+    return seed_;
+}
+
+Random& RandomManager::Stream(RandomStream stream)
+{
+    return streams_[(std::size_t)stream];
+}
+
 int RandomManager::Int(int min, int max)
 {
-    return std::uniform_int_distribution(min, max)(generator_);
+    return Stream(RandomStream::Gameplay).Int(min, max);
 }
 
 float RandomManager::Float(float min, float max)
 {
-    return std::uniform_real_distribution(min, max)(generator_);
+    return Stream(RandomStream::Gameplay).Float(min, max);
 }
 
 bool RandomManager::Bool(float probability)
 {
-    return std::bernoulli_distribution(probability)(generator_);
+    return Stream(RandomStream::Gameplay).Bool(probability);
 }
 
 sf::Vector2f RandomManager::Position(sf::Vector2f min, sf::Vector2f max)
 {
-    return {Float(min.x, max.x), Float(min.y, max.y)};
+    return Stream(RandomStream::Gameplay).Position(min, max);
 }
 
 sf::Angle RandomManager::Angle(sf::Angle min, sf::Angle max)
 {
-    return sf::degrees(Float(min.asDegrees(), max.asDegrees()));
+    return Stream(RandomStream::Gameplay).Angle(min, max);
 }
 
 sf::Color RandomManager::Color(sf::Color min, sf::Color max)
 {
-    return {(uint8_t)Int(min.r, max.r), (uint8_t)Int(min.g, max.g), (uint8_t)Int(min.b, max.b)};
+    return Stream(RandomStream::Gameplay).Color(min, max);
 }
\ No newline at end of file
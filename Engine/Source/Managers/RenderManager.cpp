@@ -2,18 +2,18 @@
 
 #include "Managers/RenderManager.h"
 
-#include <utility>
-
 #include "Graphics/Effects/EffectBloom.h"
 #include "Graphics/Effects/EffectMonitor.h"
 
 #include "Core/EngineConfig.h"
-#include "Utils/Verify.h"
 
-RenderManager::RenderManager() :
+RenderManager::RenderManager(ShaderManager& shaders) :
     target_(sf::Vector2u(gConfig.windowSize)),
     backgroundTexture_("Content/Textures/Background.png"),
-    background_(gConfig.windowSize)
+    background_(gConfig.windowSize),
+    overdrawShader_(nullptr),
+    heatmapShader_(nullptr),
+    overdrawVisible_(false)
 {
     target_.setSmooth(true);
 
@@ -22,47 +22,79 @@ RenderManager::RenderManager() :
 
     if (sf::Shader::isAvailable())
     {
-        VERIFY(effectsTarget_.resize(sf::Vector2u(gConfig.windowSize)));
+        effects_.emplace_back(std::make_unique<EffectBloom>(shaders, targetPool_));
+        effects_.emplace_back(std::make_unique<EffectMonitor>(shaders));
 
-        effects_.emplace_back(std::make_unique<EffectBloom>());
-        effects_.emplace_back(std::make_unique<EffectMonitor>());
+        overdrawShader_ = &shaders.FetchShader("Overdraw.frag");
+        heatmapShader_ = &shaders.FetchShader("Heatmap.frag");
     }
 }
 
-void RenderManager::BeginDrawing()
+void RenderManager::BeginDrawing(bool sceneOpaque)
 {
     target_.clear();
 
-    Draw(background_);
+    // The engine background is fully hidden by scenes that cover the window
+    if (!sceneOpaque)
+    {
+        Draw(background_);
+    }
 }
 
-const sf::Texture& RenderManager::FinishDrawing()
+void RenderManager::FinishDrawing(sf::RenderTarget& window)
 {
     target_.display();
 
-    sf::RenderTexture* input  = &target_;
-    sf::RenderTexture* output = &effectsTarget_;
+    // Pooled targets are released as soon as they are consumed, the final one only once it is drawn to the window
+    if (overdrawVisible_)
+    {
+        sf::RenderTexture& output = targetPool_.Acquire(target_.getSize());
+
+        heatmapShader_->setUniform("sourceTexture", sf::Shader::CurrentTexture);
+
+        output.clear();
+        output.draw(sf::Sprite(target_.getTexture()), heatmapShader_);
+        output.display();
+
+        window.draw(sf::Sprite(output.getTexture()));
+        targetPool_.Release(output);
+        return;
+    }
+
+    sf::RenderTexture* input = &target_;
 
     for (auto& effect : effects_)
     {
+        sf::RenderTexture* output = &targetPool_.Acquire(target_.getSize());
+
         output->clear();
         effect->Apply(input->getTexture(), *output);
         output->display();
 
-        std::swap(input, output);
+        if (input != &target_)
+        {
+            targetPool_.Release(*input);
+        }
+
+        input = output;
     }
 
-    return input->getTexture();
+    window.draw(sf::Sprite(input->getTexture()));
+
+    if (input != &target_)
+    {
+        targetPool_.Release(*input);
+    }
 }
 
 void RenderManager::Draw(const sf::Drawable& drawable)
 {
-    target_.draw(drawable);
+    target_.draw(drawable, GetRenderStates());
 }
 
 void RenderManager::Draw(std::span<sf::Vertex> vertices, sf::PrimitiveType type)
 {
-    target_.draw(vertices.data(), vertices.size(), type);
+    target_.draw(vertices.data(), vertices.size(), type, GetRenderStates());
 }
 
 void RenderManager::SetView(const sf::View& view)
@@ -73,4 +105,33 @@ void RenderManager::SetView(const sf::View& view)
 void RenderManager::ResetView()
 {
     SetView(target_.getDefaultView());
+}
+
+void RenderManager::SetOverdrawVisible(bool visible)
+{
+    overdrawVisible_ = visible && sf::Shader::isAvailable();
+}
+
+bool RenderManager::IsOverdrawVisible() const
+{
+    return overdrawVisible_;
+}
+
+const RenderTargetPool& RenderManager::GetTargetPool() const
+{
+    return targetPool_;
+}
+
+sf::RenderStates RenderManager::GetRenderStates() const
+{
+    if (!overdrawVisible_)
+    {
+        return sf::RenderStates::Default;
+    }
+
+    // Every covered pixel accumulates one layer, whatever the drawable colour
+    sf::RenderStates states(overdrawShader_);
+    states.blendMode = sf::BlendAdd;
+
+    return states;
 }
\ No newline at end of file
@@ -2,59 +2,640 @@
 
 #include "Managers/ResourceManager.h"
 
+#include <SFML/Audio/InputSoundFile.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/System/Clock.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <utility>
+
+#include "Core/EngineConfig.h"
 #include "Utils/Log.h"
 
-sf::Texture* ResourceManager::FetchTexture(const std::string& filename)
+namespace
+{
+    const std::filesystem::path ARCHIVE_PATH = "Content.pak";
+    const std::filesystem::path CACHE_PATH = "Content/Cache";
+
+    std::size_t GetMemorySize(const sf::Texture& texture)
+    {
+        return std::size_t(texture.getSize().x) * texture.getSize().y * 4;
+    }
+
+    std::size_t GetMemorySize(const sf::SoundBuffer& sound)
+    {
+        return std::size_t(sound.getSampleCount()) * sizeof(std::int16_t);
+    }
+
+    bool Upload(sf::Texture& texture, const DecodedImage& image)
+    {
+        if (!texture.resize(image.size))
+        {
+            return false;
+        }
+
+        texture.update(image.pixels.data());
+        return true;
+    }
+
+    bool Upload(sf::SoundBuffer& sound, const DecodedSound& decoded)
+    {
+        return sound.loadFromSamples(decoded.samples.data(), decoded.samples.size(),
+                                     decoded.channelCount, decoded.sampleRate, decoded.channelMap);
+    }
+
+    template <class Entries>
+    void Touch(Entries& entries, std::uint64_t frame)
+    {
+        for (auto& [filename, entry] : entries)
+        {
+            // The manager holds one reference, any other one belongs to a live handle
+            if (entry.resource.use_count() > 1)
+            {
+                entry.lastUse = frame;
+            }
+        }
+    }
+
+    template <class Entries>
+    auto FindLeastRecentlyUsed(Entries& entries)
+    {
+        auto oldest = entries.end();
+
+        for (auto it = entries.begin(); it != entries.end(); ++it)
+        {
+            if (it->second.resource.use_count() == 1 && it->second.size > 0 &&
+                (oldest == entries.end() || it->second.lastUse < oldest->second.lastUse))
+            {
+                oldest = it;
+            }
+        }
+
+        return oldest;
+    }
+
+    template <class Entries>
+    std::size_t GetEntriesMemoryUsage(const Entries& entries, const std::string* scene = nullptr)
+    {
+        std::size_t usage = 0;
+
+        for (const auto& [filename, entry] : entries)
+        {
+            if (!scene || entry.scene == *scene)
+            {
+                usage += entry.size;
+            }
+        }
+
+        return usage;
+    }
+
+    template <class Entries>
+    std::size_t GetEntriesHeldMemoryUsage(const Entries& entries)
+    {
+        std::size_t usage = 0;
+
+        for (const auto& [filename, entry] : entries)
+        {
+            if (entry.resource.use_count() > 1)
+            {
+                usage += entry.size;
+            }
+        }
+
+        return usage;
+    }
+}
+
+ResourceManager::ResourceManager() :
+    cache_(CACHE_PATH)
 {
-    if (!textures_.contains(filename))
+    // Loose files under Content/ remain the fallback when no packed archive is shipped
+    if (std::filesystem::exists(ARCHIVE_PATH))
     {
-        if (!textures_[filename].loadFromFile("Content/Textures/" + filename))
+        archive_.Open(ARCHIVE_PATH);
+    }
+}
+
+ResourceHandle<sf::Texture> ResourceManager::FetchTexture(const std::string& filename)
+{
+    const std::string path = "Content/Textures/" + filename;
+    Finish(path);
+
+    auto& entry = Track(textures_, filename);
+
+    if (!entry.resource->has_value())
+    {
+        const auto image = DecodeImage(path);
+
+        if (!image || !Upload(entry.resource->emplace(), *image))
         {
             LOG_ERROR("Failed to load texture: {}", filename);
-            return nullptr;
+            entry.resource->reset();
+        }
+        else
+        {
+            entry.size = GetMemorySize(**entry.resource);
         }
     }
 
-    return &textures_.at(filename);
+    return ResourceHandle(entry.resource);
 }
 
-sf::SoundBuffer* ResourceManager::FetchSound(const std::string& filename)
+ResourceHandle<sf::SoundBuffer> ResourceManager::FetchSound(const std::string& filename)
 {
-    if (!sounds_.contains(filename))
+    const std::string path = "Content/Sounds/" + filename;
+    Finish(path);
+
+    auto& entry = Track(sounds_, filename);
+
+    if (!entry.resource->has_value())
     {
-        if (!sounds_[filename].loadFromFile("Content/Sounds/" + filename))
+        const auto sound = DecodeSound(path);
+
+        if (!sound || !Upload(entry.resource->emplace(), *sound))
         {
             LOG_ERROR("Failed to load sound: {}", filename);
-            return nullptr;
+            entry.resource->reset();
+        }
+        else
+        {
+            entry.size = GetMemorySize(**entry.resource);
         }
     }
 
-    return &sounds_.at(filename);
+    return ResourceHandle(entry.resource);
 }
 
-sf::Font* ResourceManager::FetchFont(const std::string& filename)
+ResourceHandle<sf::Font> ResourceManager::FetchFont(const std::string& filename)
 {
-    if (!fonts_.contains(filename))
+    const std::string path = "Content/Fonts/" + filename;
+    Finish(path);
+
+    auto& entry = Track(fonts_, filename);
+
+    if (!entry.resource->has_value())
     {
-        if (!fonts_[filename].openFromFile("Content/Fonts/" + filename))
+        // Fonts stream glyphs from their memory, so the entry keeps any inflated data alive
+        if (!Load(entry.resource->emplace(), path, entry.data))
         {
             LOG_ERROR("Failed to load font: {}", filename);
-            return nullptr;
+            entry.resource->reset();
+        }
+        else
+        {
+            entry.size = GetFileSize(path);
         }
     }
 
-    return &fonts_.at(filename);
+    return ResourceHandle(entry.resource);
 }
 
-std::optional<sf::Music> ResourceManager::FetchMusic(const std::string& filename) const
+std::optional<sf::Music> ResourceManager::FetchMusic(const std::string& filename)
 {
     sf::Music music;
 
-    if (!music.openFromFile("Content/Musics/" + filename))
+    if (!Load(music, "Content/Musics/" + filename, musicData_[filename]))
     {
         LOG_ERROR("Failed to load music: {}", filename);
         return std::nullopt;
     }
 
     return music;
+}
+
+ResourceHandle<sf::Texture> ResourceManager::FetchTexture(TextureId id)
+{
+    return FetchSlot(textureSlots_, std::size_t(id), textures_, TEXTURE_FILENAMES[std::size_t(id)],
+                     [this](const std::string& filename) { FetchTexture(filename); }, true);
+}
+
+ResourceHandle<sf::SoundBuffer> ResourceManager::FetchSound(SoundId id)
+{
+    return FetchSlot(soundSlots_, std::size_t(id), sounds_, SOUND_FILENAMES[std::size_t(id)],
+                     [this](const std::string& filename) { FetchSound(filename); }, true);
+}
+
+ResourceHandle<sf::Font> ResourceManager::FetchFont(FontId id)
+{
+    return FetchSlot(fontSlots_, std::size_t(id), fonts_, FONT_FILENAMES[std::size_t(id)],
+                     [this](const std::string& filename) { FetchFont(filename); }, true);
+}
+
+std::optional<sf::Music> ResourceManager::FetchMusic(MusicId id)
+{
+    return FetchMusic(std::string(MUSIC_FILENAMES[std::size_t(id)]));
+}
+
+ResourceHandle<sf::Texture> ResourceManager::FetchTextureAsync(const std::string& filename)
+{
+    auto& entry = Track(textures_, filename);
+
+    if (!entry.resource->has_value())
+    {
+        // Decoding runs on a worker, the GPU upload is left to the main thread
+        Request("Content/Textures/" + filename, [this, filename]() -> Finisher {
+            auto image = DecodeImage("Content/Textures/" + filename);
+
+            if (!image)
+            {
+                return [filename] { LOG_ERROR("Failed to load texture: {}", filename); };
+            }
+
+            return [this, filename, image = std::move(*image)] {
+                auto& entry = Track(textures_, filename);
+
+                if (!Upload(entry.resource->emplace(), image))
+                {
+                    LOG_ERROR("Failed to upload texture: {}", filename);
+                    entry.resource->reset();
+                }
+                else
+                {
+                    entry.size = GetMemorySize(**entry.resource);
+                }
+            };
+        });
+    }
+
+    return ResourceHandle(entry.resource);
+}
+
+ResourceHandle<sf::SoundBuffer> ResourceManager::FetchSoundAsync(const std::string& filename)
+{
+    auto& entry = Track(sounds_, filename);
+
+    if (!entry.resource->has_value())
+    {
+        Request("Content/Sounds/" + filename, [this, filename]() -> Finisher {
+            auto sound = DecodeSound("Content/Sounds/" + filename);
+
+            if (!sound)
+            {
+                return [filename] { LOG_ERROR("Failed to load sound: {}", filename); };
+            }
+
+            return [this, filename, sound = std::move(*sound)] {
+                auto& entry = Track(sounds_, filename);
+
+                if (!Upload(entry.resource->emplace(), sound))
+                {
+                    LOG_ERROR("Failed to load sound: {}", filename);
+                    entry.resource->reset();
+                }
+                else
+                {
+                    entry.size = GetMemorySize(**entry.resource);
+                }
+            };
+        });
+    }
+
+    return ResourceHandle(entry.resource);
+}
+
+ResourceHandle<sf::Font> ResourceManager::FetchFontAsync(const std::string& filename)
+{
+    auto& entry = Track(fonts_, filename);
+
+    if (!entry.resource->has_value())
+    {
+        Request("Content/Fonts/" + filename, [this, filename]() -> Finisher {
+            const std::string path = "Content/Fonts/" + filename;
+            auto font = std::make_shared<sf::Font>();
+            auto buffer = std::make_shared<ContentBuffer>();
+
+            if (!Load(*font, path, *buffer))
+            {
+                return [filename] { LOG_ERROR("Failed to load font: {}", filename); };
+            }
+
+            // Moving the buffer keeps its storage, so the font still points at valid memory
+            return [this, filename, font, buffer, size = GetFileSize(path)] {
+                auto& entry = Track(fonts_, filename);
+                entry.data = std::move(*buffer);
+                entry.resource->emplace(std::move(*font));
+                entry.size = size;
+            };
+        });
+    }
+
+    return ResourceHandle(entry.resource);
+}
+
+ResourceHandle<sf::Texture> ResourceManager::FetchTextureAsync(TextureId id)
+{
+    return FetchSlot(textureSlots_, std::size_t(id), textures_, TEXTURE_FILENAMES[std::size_t(id)],
+                     [this](const std::string& filename) { FetchTextureAsync(filename); }, false);
+}
+
+ResourceHandle<sf::SoundBuffer> ResourceManager::FetchSoundAsync(SoundId id)
+{
+    return FetchSlot(soundSlots_, std::size_t(id), sounds_, SOUND_FILENAMES[std::size_t(id)],
+                     [this](const std::string& filename) { FetchSoundAsync(filename); }, false);
+}
+
+ResourceHandle<sf::Font> ResourceManager::FetchFontAsync(FontId id)
+{
+    return FetchSlot(fontSlots_, std::size_t(id), fonts_, FONT_FILENAMES[std::size_t(id)],
+                     [this](const std::string& filename) { FetchFontAsync(filename); }, false);
+}
+
+bool ResourceManager::IsLoading() const
+{
+    return std::ranges::any_of(pending_, [](const auto& pending) { return !pending.second.background; });
+}
+
+float ResourceManager::GetLoadingProgress() const
+{
+    return (requestedCount_ > 0) ? float(finishedCount_) / requestedCount_ : 1.f;
+}
+
+void ResourceManager::Prefetch(const std::string& scene, const ResourceManifest& manifest)
+{
+    prefetchedTextures_.clear();
+    prefetchedSounds_.clear();
+    prefetchedFonts_.clear();
+
+    const std::string scope = std::exchange(scope_, scene);
+    prefetching_ = true;
+
+    for (TextureId id : manifest.textures)
+    {
+        prefetchedTextures_.push_back(FetchTextureAsync(id));
+    }
+
+    for (SoundId id : manifest.sounds)
+    {
+        prefetchedSounds_.push_back(FetchSoundAsync(id));
+    }
+
+    for (FontId id : manifest.fonts)
+    {
+        prefetchedFonts_.push_back(FetchFontAsync(id));
+    }
+
+    prefetching_ = false;
+    scope_ = scope;
+}
+
+void ResourceManager::SetScope(const std::string& scene)
+{
+    // The new scene holds its own handles from here on
+    prefetchedTextures_.clear();
+    prefetchedSounds_.clear();
+    prefetchedFonts_.clear();
+
+    scope_ = scene;
+}
+
+std::size_t ResourceManager::GetMemoryUsage(ResourceType type) const
+{
+    switch (type)
+    {
+        case ResourceType::Texture: return GetEntriesMemoryUsage(textures_);
+        case ResourceType::Sound:   return GetEntriesMemoryUsage(sounds_);
+        case ResourceType::Font:    return GetEntriesMemoryUsage(fonts_);
+    }
+
+    return 0;
+}
+
+std::size_t ResourceManager::GetSceneMemoryUsage(const std::string& scene) const
+{
+    return GetEntriesMemoryUsage(textures_, &scene) +
+           GetEntriesMemoryUsage(sounds_, &scene) +
+           GetEntriesMemoryUsage(fonts_, &scene);
+}
+
+std::size_t ResourceManager::GetHeldMemoryUsage() const
+{
+    return GetEntriesHeldMemoryUsage(textures_) +
+           GetEntriesHeldMemoryUsage(sounds_) +
+           GetEntriesHeldMemoryUsage(fonts_);
+}
+
+void ResourceManager::Update()
+{
+    const sf::Clock clock;
+
+    // Uploads are time-sliced so that a burst of finished decodes never stalls a frame
+    for (auto it = pending_.begin(); it != pending_.end() && clock.getElapsedTime() < gConfig.resourceUploadBudget;)
+    {
+        if (it->second.result.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        {
+            it->second.result.get()();
+            finishedCount_ += !it->second.background;
+            it = pending_.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    if (!IsLoading())
+    {
+        requestedCount_ = finishedCount_ = 0;
+    }
+
+    frame_++;
+    Evict();
+}
+
+void ResourceManager::Evict()
+{
+    Touch(textures_, frame_);
+    Touch(sounds_, frame_);
+
+    // Textures are weighed against the VRAM budget, sounds and fonts share the RAM one
+    for (std::size_t usage = GetMemoryUsage(ResourceType::Texture); usage > gConfig.textureMemoryBudget;)
+    {
+        const auto it = FindLeastRecentlyUsed(textures_);
+
+        if (it == textures_.end())
+        {
+            break;
+        }
+
+        LOG_INFO("Evicting texture: {} ({} KB)", it->first, it->second.size / 1024);
+        usage -= it->second.size;
+        textures_.erase(it);
+        textureSlots_.fill(nullptr);
+    }
+
+    // Fonts are never evicted, sf::Text and TGUI keep raw references to them past any handle
+    for (std::size_t usage = GetMemoryUsage(ResourceType::Sound) + GetMemoryUsage(ResourceType::Font); usage > gConfig.resourceMemoryBudget;)
+    {
+        const auto it = FindLeastRecentlyUsed(sounds_);
+
+        if (it == sounds_.end())
+        {
+            break;
+        }
+
+        LOG_INFO("Evicting sound: {} ({} KB)", it->first, it->second.size / 1024);
+        usage -= it->second.size;
+        sounds_.erase(it);
+        soundSlots_.fill(nullptr);
+    }
+}
+
+template <class T, std::size_t N, class Fetch>
+ResourceHandle<T> ResourceManager::FetchSlot(std::array<Entry<T>*, N>& slots, std::size_t index, Entries<T>& entries,
+                                             std::string_view filename, Fetch fetch, bool wait)
+{
+    Entry<T>*& slot = slots[index];
+
+    // The filename is only hashed on the first fetch, after an eviction, or to wait for a pending load
+    if (!slot || (wait && !slot->resource->has_value()))
+    {
+        const std::string name(filename);
+        fetch(name);
+        slot = &entries.at(name);
+    }
+
+    slot->lastUse = frame_;
+    return ResourceHandle(slot->resource);
+}
+
+template <class T>
+ResourceManager::Entry<T>& ResourceManager::Track(Entries<T>& entries, const std::string& filename)
+{
+    auto& entry = entries[filename];
+
+    // Resources are accounted to the scene that first asked for them
+    if (entry.scene.empty())
+    {
+        entry.scene = scope_;
+    }
+
+    entry.lastUse = frame_;
+    return entry;
+}
+
+template <class T>
+bool ResourceManager::Load(T& resource, const std::string& path, ContentBuffer& buffer) const
+{
+    // Archived entries are handed to SFML straight from the mapping, without any intermediate copy
+    if (const auto data = archive_.Read(path, buffer))
+    {
+        if constexpr (requires { resource.openFromMemory(data->data(), data->size()); })
+        {
+            return resource.openFromMemory(data->data(), data->size());
+        }
+        else
+        {
+            return resource.loadFromMemory(data->data(), data->size());
+        }
+    }
+
+    if constexpr (requires { resource.openFromFile(path); })
+    {
+        return resource.openFromFile(path);
+    }
+    else
+    {
+        return resource.loadFromFile(path);
+    }
+}
+
+std::optional<DecodedImage> ResourceManager::DecodeImage(const std::string& path) const
+{
+    const auto source = GetSource(path);
+
+    // Decoding PNGs dominates a cold start, so later runs map the raw pixels instead
+    if (auto image = cache_.FindImage(path, source))
+    {
+        return image;
+    }
+
+    auto image = std::make_shared<sf::Image>();
+    ContentBuffer buffer;
+
+    if (!Load(*image, path, buffer))
+    {
+        return std::nullopt;
+    }
+
+    const auto size = image->getSize();
+    const DecodedImage decoded{size, {image->getPixelsPtr(), std::size_t(size.x) * size.y * 4}, image};
+
+    cache_.StoreImage(path, source, decoded);
+    return decoded;
+}
+
+std::optional<DecodedSound> ResourceManager::DecodeSound(const std::string& path) const
+{
+    const auto source = GetSource(path);
+
+    if (auto sound = cache_.FindSound(path, source))
+    {
+        return sound;
+    }
+
+    sf::InputSoundFile file;
+    ContentBuffer buffer;
+
+    if (!Load(file, path, buffer))
+    {
+        return std::nullopt;
+    }
+
+    auto samples = std::make_shared<std::vector<std::int16_t>>(file.getSampleCount());
+    samples->resize(file.read(samples->data(), samples->size()));
+
+    const DecodedSound decoded{file.getChannelCount(), file.getSampleRate(), file.getChannelMap(), *samples, samples};
+
+    cache_.StoreSound(path, source, decoded);
+    return decoded;
+}
+
+void ResourceManager::Request(const std::string& path, std::function<Finisher()> decode)
+{
+    if (const auto it = pending_.find(path); it != pending_.end())
+    {
+        // A scene now waits on what was only prefetched
+        if (it->second.background && !prefetching_)
+        {
+            it->second.background = false;
+            requestedCount_++;
+        }
+    }
+    else
+    {
+        pending_.emplace(path, Pending{std::async(std::launch::async, std::move(decode)), prefetching_});
+        requestedCount_ += !prefetching_;
+    }
+}
+
+void ResourceManager::Finish(const std::string& path)
+{
+    if (const auto it = pending_.find(path); it != pending_.end())
+    {
+        it->second.result.get()();
+        finishedCount_ += !it->second.background;
+        pending_.erase(it);
+    }
+}
+
+std::filesystem::path ResourceManager::GetSource(const std::string& path) const
+{
+    // Archived entries are invalidated together whenever the archive is rebuilt
+    return archive_.Contains(path) ? ARCHIVE_PATH : std::filesystem::path(path);
+}
+
+std::size_t ResourceManager::GetFileSize(const std::string& path) const
+{
+    if (const auto size = archive_.GetSize(path))
+    {
+        return *size;
+    }
+
+    std::error_code error;
+    const auto size = std::filesystem::file_size(path, error);
+
+    return error ? 0 : std::size_t(size);
 }
\ No newline at end of file
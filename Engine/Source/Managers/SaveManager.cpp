@@ -2,42 +2,283 @@
 
 #include "Managers/SaveManager.h"
 
-#include <fstream>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+
+#include "Core/EngineConfig.h"
+#include "Utils/Log.h"
+
+namespace
+{
+    const std::filesystem::path JSON_PATH = "Content/Save.json";
+    const std::filesystem::path BINARY_PATH = "Content/Save.msgpack";
+    const std::filesystem::path JOURNAL_PATH = "Content/Save.journal";
+
+    const std::size_t COMPACTION_THRESHOLD = 64 << 10;
+
+    nlohmann::json ReadSnapshot(const std::filesystem::path& path, bool binary)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            return nullptr;
+        }
+
+        auto values = binary ? nlohmann::json::from_msgpack(file, true, false) : nlohmann::json::parse(file, nullptr, false);
+        return values.is_object() ? values : nullptr;
+    }
+
+    // Journal records are {"k", "v"} for a set, {"k"} for an erase and {} for a clear
+    bool Apply(nlohmann::json& values, const nlohmann::json& record)
+    {
+        if (!record.is_object())
+        {
+            return false;
+        }
+
+        if (record.empty())
+        {
+            values.clear();
+            return true;
+        }
+
+        const auto key = record.find("k");
+        if (key == record.end() || !key->is_string())
+        {
+            return false;
+        }
+
+        if (const auto value = record.find("v"); value != record.end())
+        {
+            values[key->get<std::string>()] = *value;
+        }
+        else
+        {
+            values.erase(key->get<std::string>());
+        }
+
+        return true;
+    }
+}
 
 SaveManager::SaveManager()
 {
-    if (std::ifstream file{"Content/Save.json"})
+    Load();
+
+    // A torn record from a crash would hide everything appended after it, so cut the journal back to its last whole record
+    if (!Replay())
     {
-        values_ = nlohmann::json::parse(file);
+        std::error_code error;
+        std::filesystem::resize_file(JOURNAL_PATH, journalSize_, error);
     }
-    else
+
+    // Compaction reopens the journal itself, keep appending to the current one if the snapshot could not be written
+    if (journalSize_ < COMPACTION_THRESHOLD || !Compact(values_))
     {
-        values_ = nlohmann::json::object();
+        journal_.open(JOURNAL_PATH, std::ios::binary | std::ios::app);
     }
+
+    writer_ = std::jthread([this](std::stop_token stopToken) { Run(stopToken); });
 }
 
 SaveManager::~SaveManager()
 {
+    // The writer flushes the last changes before it exits
+    writer_.request_stop();
+    writer_.join();
+}
+
+bool SaveManager::Has(std::string_view key) const
+{
+    std::scoped_lock lock(mutex_);
+    return values_.contains(key);
+}
+
+void SaveManager::Erase(std::string_view key)
+{
+    std::scoped_lock lock(mutex_);
+
+    if (values_.contains(key))
+    {
+        values_.erase(key);
+        pending_.push_back({{"k", key}});
+    }
+}
+
+void SaveManager::Clear()
+{
+    std::scoped_lock lock(mutex_);
+
     if (!values_.empty())
     {
-        if (std::ofstream file{"Content/Save.json"})
+        values_.clear();
+        pending_.push_back(nlohmann::json::object());
+    }
+}
+
+void SaveManager::Write(std::string_view key, nlohmann::json value)
+{
+    std::scoped_lock lock(mutex_);
+
+    // Unchanged values never reach the disk
+    if (const auto it = values_.find(key); it != values_.end() && *it == value)
+    {
+        return;
+    }
+
+    pending_.push_back({{"k", key}, {"v", value}});
+    values_[key] = std::move(value);
+}
+
+void SaveManager::Load()
+{
+    // Fall back to the other encoding so that toggling saveBinary keeps existing saves
+    auto values = ReadSnapshot(gConfig.saveBinary ? BINARY_PATH : JSON_PATH, gConfig.saveBinary);
+
+    if (values.is_null())
+    {
+        values = ReadSnapshot(gConfig.saveBinary ? JSON_PATH : BINARY_PATH, !gConfig.saveBinary);
+    }
+
+    values_ = values.is_null() ? nlohmann::json::object() : std::move(values);
+}
+
+bool SaveManager::Replay()
+{
+    std::error_code error;
+    const std::size_t fileSize = std::filesystem::file_size(JOURNAL_PATH, error);
+    std::ifstream file(JOURNAL_PATH, std::ios::binary);
+    std::vector<std::uint8_t> record;
+    std::uint32_t size = 0;
+
+    journalSize_ = 0;
+
+    while (file.read(reinterpret_cast<char*>(&size), sizeof(size)))
+    {
+        if (size > fileSize - journalSize_ - sizeof(size))
+        {
+            LOG_WARNING("Discarding corrupted save journal tail");
+            return false;
+        }
+
+        record.resize(size);
+
+        if (!file.read(reinterpret_cast<char*>(record.data()), size) ||
+            !Apply(values_, nlohmann::json::from_msgpack(record, true, false)))
         {
-            file << values_.dump(4);
+            LOG_WARNING("Discarding corrupted save journal tail");
+            return false;
         }
+
+        journalSize_ += sizeof(size) + size;
     }
+
+    // Anything left after the last whole record is a partially written size
+    return file.gcount() == 0;
 }
 
-bool SaveManager::Has(std::string_view key) const
+void SaveManager::Flush()
 {
-    return values_.contains(key);
+    std::vector<nlohmann::json> records;
+    nlohmann::json snapshot;
+
+    {
+        std::scoped_lock lock(mutex_);
+
+        if (pending_.empty())
+        {
+            return;
+        }
+
+        records.swap(pending_);
+
+        if (journalSize_ >= COMPACTION_THRESHOLD)
+        {
+            snapshot = values_;
+        }
+    }
+
+    for (const auto& record : records)
+    {
+        const auto bytes = nlohmann::json::to_msgpack(record);
+        const auto size = std::uint32_t(bytes.size());
+
+        journal_.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        journal_.write(reinterpret_cast<const char*>(bytes.data()), size);
+        journalSize_ += sizeof(size) + size;
+    }
+
+    if (!journal_.flush())
+    {
+        LOG_ERROR("Failed to write save journal: {}", JOURNAL_PATH.string());
+    }
+
+    // Journaled first, so that the journal left by a crash during compaction ends on the snapshot values
+    if (!snapshot.is_null())
+    {
+        Compact(snapshot);
+    }
 }
 
-void SaveManager::Erase(std::string_view key)
+bool SaveManager::Compact(const nlohmann::json& snapshot)
 {
-    values_.erase(key);
+    const auto& path = gConfig.saveBinary ? BINARY_PATH : JSON_PATH;
+    auto temporary = path;
+    temporary += ".tmp";
+
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+
+        if (gConfig.saveBinary)
+        {
+            const auto bytes = nlohmann::json::to_msgpack(snapshot);
+            file.write(reinterpret_cast<const char*>(bytes.data()), std::streamsize(bytes.size()));
+        }
+        else
+        {
+            file << snapshot.dump(4);
+        }
+
+        if (!file.flush())
+        {
+            LOG_ERROR("Failed to write save: {}", temporary.string());
+            return false;
+        }
+    }
+
+    // A crash between these two steps replays the whole journal over the new snapshot
+    // Every change since the previous snapshot is in it, so each value still ends on its latest write
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+
+    if (error)
+    {
+        LOG_ERROR("Failed to replace save: {}", path.string());
+        return false;
+    }
+
+    // Load falls back to the other encoding, so a stale snapshot left there would resurface if this one went missing
+    std::filesystem::remove(gConfig.saveBinary ? JSON_PATH : BINARY_PATH, error);
+
+    journal_.close();
+    journal_.open(JOURNAL_PATH, std::ios::binary | std::ios::trunc);
+    journalSize_ = 0;
+
+    return true;
 }
 
-void SaveManager::Clear()
+void SaveManager::Run(std::stop_token stopToken)
 {
-    values_.clear();
+    const auto interval = std::chrono::microseconds(gConfig.saveInterval.asMicroseconds());
+
+    while (!stopToken.stop_requested())
+    {
+        {
+            std::unique_lock lock(mutex_);
+            wakeUp_.wait_for(lock, stopToken, interval, [] { return false; });
+        }
+
+        Flush();
+    }
 }
\ No newline at end of file
@@ -26,6 +26,11 @@ std::optional<std::string> SceneManager::FetchNextScene()
     return std::nullopt;
 }
 
+std::optional<std::string> SceneManager::FetchPrefetchScene()
+{
+    return std::exchange(prefetchScene_, std::nullopt);
+}
+
 void SceneManager::ChangeScene(std::string_view name)
 {
     if (!nextScene_)
@@ -37,4 +42,9 @@ void SceneManager::ChangeScene(std::string_view name)
 void SceneManager::RestartCurrentScene()
 {
     ChangeScene(currentScene_);
+}
+
+void SceneManager::PrefetchScene(std::string_view name)
+{
+    prefetchScene_ = name;
 }
\ No newline at end of file
@@ -0,0 +1,99 @@
+// Copyright (c) 2025 Adel Hales
+
+#include "Managers/ShaderManager.h"
+
+#include <SFML/Window/Context.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include "Utils/Log.h"
+
+namespace
+{
+    const std::filesystem::path SHADERS_PATH = "Content/Shaders";
+    const std::string VERTEX_SHADER_FILENAME = "Default.vert";
+
+    std::string ReadFile(const std::filesystem::path& path)
+    {
+        std::ifstream file(path);
+        std::ostringstream stream;
+        stream << file.rdbuf();
+
+        return stream.str();
+    }
+}
+
+ShaderManager::ShaderManager()
+{
+    if (!sf::Shader::isAvailable())
+    {
+        return;
+    }
+
+    // Every program shares the same vertex stage, so it is read once and each
+    // fragment shader is linked with it exactly once
+    vertexSource_ = ReadFile(SHADERS_PATH / VERTEX_SHADER_FILENAME);
+
+    std::vector<std::pair<sf::Shader*, std::string>> pending;
+
+    for (const auto& entry : std::filesystem::directory_iterator(SHADERS_PATH))
+    {
+        if (entry.path().extension() == ".frag")
+        {
+            const std::string filename = entry.path().filename().string();
+            auto& shader = shaders_[filename] = std::make_unique<sf::Shader>();
+
+            pending.emplace_back(shader.get(), filename);
+        }
+    }
+
+    // Compile on a background context shared with the window, while scenes load
+    warmup_ = std::async(std::launch::async, [this, pending = std::move(pending)] {
+        sf::Context context;
+
+        for (const auto& [shader, filename] : pending)
+        {
+            if (!Compile(*shader, filename))
+            {
+                LOG_ERROR("Failed to compile shader: {}", filename);
+            }
+        }
+    });
+
+    LOG_INFO("Compiling {} shaders in the background", shaders_.size());
+}
+
+sf::Shader& ShaderManager::FetchShader(const std::string& fragmentFilename)
+{
+    if (!shaders_.contains(fragmentFilename))
+    {
+        LOG_WARNING("Shader not warmed up, compiling on demand: {}", fragmentFilename);
+
+        FinishWarmup();
+
+        auto& shader = shaders_[fragmentFilename] = std::make_unique<sf::Shader>();
+        if (!Compile(*shader, fragmentFilename))
+        {
+            LOG_ERROR("Failed to compile shader: {}", fragmentFilename);
+        }
+    }
+
+    return *shaders_.at(fragmentFilename);
+}
+
+void ShaderManager::FinishWarmup()
+{
+    if (warmup_.valid())
+    {
+        warmup_.get();
+        LOG_INFO("Shaders compiled");
+    }
+}
+
+bool ShaderManager::Compile(sf::Shader& shader, const std::string& fragmentFilename) const
+{
+    return shader.loadFromMemory(vertexSource_, ReadFile(SHADERS_PATH / fragmentFilename));
+}
\ No newline at end of file
@@ -3,24 +3,75 @@
 #include "Managers/TimeManager.h"
 
 #include <algorithm>
+#include <cmath>
 
 #include "Core/EngineConfig.h"
 
+namespace
+{
+    const float MAXIMUM_TIME_SCALE = 64;
+}
+
+TimeManager::TimeManager()
+{
+    sceneClock_ = &defaultClock_;
+}
+
 void TimeManager::Update()
 {
     const sf::Time currentTime = clock_.getElapsedTime();
 
-    deltaTime_ = std::min(currentTime - previousTime_, gConfig.maximumDeltaTime);
+    realDeltaTime_ = std::min(currentTime - previousTime_, gConfig.maximumDeltaTime);
+
+    // Above 1x the scaled frame is split into equal steps no longer than a real frame, so fast-forward stays stable
+    stepCount_ = std::max((int)std::ceil(sceneClock_->timeScale), 1);
+    deltaTime_ = realDeltaTime_ * (sceneClock_->timeScale / stepCount_);
 
     previousTime_ = currentTime;
 }
 
+int TimeManager::GetStepCount() const
+{
+    return stepCount_;
+}
+
+void TimeManager::AdvanceSceneTime()
+{
+    sceneClock_->time += deltaTime_;
+}
+
 float TimeManager::GetDeltaTime() const
 {
     return deltaTime_.asSeconds();
 }
 
+float TimeManager::GetRealDeltaTime() const
+{
+    return realDeltaTime_.asSeconds();
+}
+
 float TimeManager::GetElapsedTime() const
 {
     return clock_.getElapsedTime().asSeconds();
+}
+
+void TimeManager::SetTimeScale(float scale)
+{
+    sceneClock_->timeScale = std::clamp(scale, 0.f, MAXIMUM_TIME_SCALE);
+}
+
+float TimeManager::GetTimeScale() const
+{
+    return sceneClock_->timeScale;
+}
+
+void TimeManager::SetScope(const std::string& scene)
+{
+    // Map nodes are stable, so the pointer stays valid as other scenes add their clocks
+    sceneClock_ = &sceneClocks_[scene];
+}
+
+sf::Time TimeManager::GetSceneTime()
+{
+    return sceneClock_ ? sceneClock_->time : sf::Time::Zero;
 }
\ No newline at end of file
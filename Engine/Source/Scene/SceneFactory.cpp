@@ -21,30 +21,42 @@
 #include "TicTacToe.h"
 #include "TowerDefense.h"
 
+namespace
+{
+    template <class T>
+    void Create(SceneFactory::Scenes& scenes, EngineContext& context, const std::string& name)
+    {
+        // Resources fetched while a scene is built are accounted to it, and its cooldowns start on its own clock
+        context.resources.SetScope(name);
+        context.time.SetScope(name);
+        scenes.emplace(name, std::make_unique<T>(context));
+    }
+}
+
 namespace SceneFactory
 {
     Scenes CreateScenes(EngineContext& context)
     {
         Scenes scenes;
 
-        scenes.emplace("Bounce",         std::make_unique<Bounce::Game>(context));
-        scenes.emplace("Menu",           std::make_unique<Menu::Game>(context));
-        scenes.emplace("Clicker",        std::make_unique<Clicker::Game>(context));
-        scenes.emplace("Memory Card",    std::make_unique<MemoryCard::Game>(context));
-        scenes.emplace("Tic Tac Toe",    std::make_unique<TicTacToe::Game>(context));
-        scenes.emplace("Mine Sweeper",   std::make_unique<MineSweeper::Game>(context));
-        scenes.emplace("Runner",         std::make_unique<Runner::Game>(context));
-        scenes.emplace("Tetris",         std::make_unique<Tetris::Game>(context));
-        scenes.emplace("Pong",           std::make_unique<Pong::Game>(context));
-        scenes.emplace("Breakout",       std::make_unique<Breakout::Game>(context));
-        scenes.emplace("Flappy Bird",    std::make_unique<FlappyBird::Game>(context));
-        scenes.emplace("Space Invaders", std::make_unique<SpaceInvaders::Game>(context));
-        scenes.emplace("Puzzle",         std::make_unique<Puzzle::Game>(context));
-        scenes.emplace("Snake",          std::make_unique<Snake::Game>(context));
-        scenes.emplace("Mine Storm",     std::make_unique<MineStorm::Game>(context));
-        scenes.emplace("Tower Defense",  std::make_unique<TowerDefense::Game>(context));
-        scenes.emplace("Level Editor",   std::make_unique<LevelEditor::Game>(context));
-        scenes.emplace("Adventure",      std::make_unique<Adventure::Game>(context));
+        Create<Bounce::Game>(scenes, context, "Bounce");
+        Create<Menu::Game>(scenes, context, "Menu");
+        Create<Clicker::Game>(scenes, context, "Clicker");
+        Create<MemoryCard::Game>(scenes, context, "Memory Card");
+        Create<TicTacToe::Game>(scenes, context, "Tic Tac Toe");
+        Create<MineSweeper::Game>(scenes, context, "Mine Sweeper");
+        Create<Runner::Game>(scenes, context, "Runner");
+        Create<Tetris::Game>(scenes, context, "Tetris");
+        Create<Pong::Game>(scenes, context, "Pong");
+        Create<Breakout::Game>(scenes, context, "Breakout");
+        Create<FlappyBird::Game>(scenes, context, "Flappy Bird");
+        Create<SpaceInvaders::Game>(scenes, context, "Space Invaders");
+        Create<Puzzle::Game>(scenes, context, "Puzzle");
+        Create<Snake::Game>(scenes, context, "Snake");
+        Create<MineStorm::Game>(scenes, context, "Mine Storm");
+        Create<TowerDefense::Game>(scenes, context, "Tower Defense");
+        Create<LevelEditor::Game>(scenes, context, "Level Editor");
+        Create<Adventure::Game>(scenes, context, "Adventure");
 
         return scenes;
     }
@@ -0,0 +1,174 @@
+// Copyright (c) 2025 Adel Hales
+
+#include "Utils/AllocationTracker.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    struct ZoneCounters
+    {
+        std::atomic<std::size_t> allocations;
+        std::atomic<std::size_t> frees;
+        std::atomic<std::size_t> bytes;
+    };
+
+    std::array<ZoneCounters, (std::size_t)AllocationZone::Count> counters;
+
+    // Other threads never enter a zone, their allocations land in Other
+    thread_local AllocationZone currentZone = AllocationZone::Other;
+}
+
+bool Allocation::IsTracking()
+{
+#ifdef ARCADE_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+Allocation::FrameCounters Allocation::FetchFrame()
+{
+    FrameCounters frame;
+
+    for (std::size_t i = 0; i < counters.size(); i++)
+    {
+        frame[i].allocations = counters[i].allocations.exchange(0, std::memory_order_relaxed);
+        frame[i].frees = counters[i].frees.exchange(0, std::memory_order_relaxed);
+        frame[i].bytes = counters[i].bytes.exchange(0, std::memory_order_relaxed);
+    }
+
+    return frame;
+}
+
+Allocation::ZoneScope::ZoneScope(AllocationZone zone) :
+    previous_(currentZone)
+{
+    currentZone = zone;
+}
+
+Allocation::ZoneScope::~ZoneScope()
+{
+    currentZone = previous_;
+}
+
+#ifdef ARCADE_TRACK_ALLOCATIONS
+
+namespace
+{
+    void* Allocate(std::size_t size)
+    {
+        auto& zone = counters[(std::size_t)currentZone];
+        zone.allocations.fetch_add(1, std::memory_order_relaxed);
+        zone.bytes.fetch_add(size, std::memory_order_relaxed);
+
+        return std::malloc(size ? size : 1);
+    }
+
+    void* AllocateAligned(std::size_t size, std::align_val_t alignment)
+    {
+        auto& zone = counters[(std::size_t)currentZone];
+        zone.allocations.fetch_add(1, std::memory_order_relaxed);
+        zone.bytes.fetch_add(size, std::memory_order_relaxed);
+
+        const std::size_t align = (std::size_t)alignment;
+        const std::size_t rounded = (size + align - 1) / align * align;
+
+#ifdef _WIN32
+        return _aligned_malloc(rounded ? rounded : align, align);
+#else
+        return std::aligned_alloc(align, rounded ? rounded : align);
+#endif
+    }
+
+    void Free(void* pointer)
+    {
+        if (pointer)
+        {
+            counters[(std::size_t)currentZone].frees.fetch_add(1, std::memory_order_relaxed);
+            std::free(pointer);
+        }
+    }
+
+    void FreeAligned(void* pointer)
+    {
+        if (pointer)
+        {
+            counters[(std::size_t)currentZone].frees.fetch_add(1, std::memory_order_relaxed);
+#ifdef _WIN32
+            _aligned_free(pointer);
+#else
+            std::free(pointer);
+#endif
+        }
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    if (void* pointer = Allocate(size))
+    {
+        return pointer;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    if (void* pointer = AllocateAligned(size, alignment))
+    {
+        return pointer;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return AllocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return AllocateAligned(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept { Free(pointer); }
+void operator delete[](void* pointer) noexcept { Free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { Free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { Free(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { Free(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { Free(pointer); }
+
+void operator delete(void* pointer, std::align_val_t) noexcept { FreeAligned(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { FreeAligned(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { FreeAligned(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept { FreeAligned(pointer); }
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { FreeAligned(pointer); }
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { FreeAligned(pointer); }
+
+#endif
\ No newline at end of file
@@ -0,0 +1,131 @@
+// Copyright (c) 2025 Adel Hales
+
+#include "Utils/ContentArchive.h"
+
+#include <cstring>
+
+#include "Utils/Log.h"
+#include "Utils/Lz4.h"
+
+bool ContentArchive::Open(const std::filesystem::path& path)
+{
+    entries_.clear();
+
+    if (!file_.Open(path))
+    {
+        return false;
+    }
+
+    const auto data = file_.GetData();
+    const ContentArchiveHeader expected;
+    ContentArchiveHeader header;
+
+    if (data.size() < sizeof(header))
+    {
+        LOG_ERROR("Invalid content archive: {}", path.string());
+        file_.Close();
+        return false;
+    }
+
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    if (header.magic != expected.magic || header.version != expected.version || header.indexSize > data.size() - sizeof(header))
+    {
+        LOG_ERROR("Invalid content archive: {}", path.string());
+        file_.Close();
+        return false;
+    }
+
+    const auto index = data.subspan(sizeof(header), header.indexSize);
+    std::size_t position = 0;
+
+    for (std::uint32_t i = 0; i < header.entryCount; i++)
+    {
+        ContentArchiveEntry entry;
+
+        if (index.size() - position < sizeof(entry))
+        {
+            break;
+        }
+
+        std::memcpy(&entry, &index[position], sizeof(entry));
+        position += sizeof(entry);
+
+        if (index.size() - position < entry.pathLength || entry.offset > data.size() || entry.storedSize > data.size() - entry.offset)
+        {
+            break;
+        }
+
+        std::string name(reinterpret_cast<const char*>(&index[position]), entry.pathLength);
+        position += entry.pathLength;
+
+        entries_.emplace(std::move(name), Entry{data.subspan(entry.offset, entry.storedSize), entry.originalSize, entry.compressed != 0});
+    }
+
+    if (entries_.size() != header.entryCount)
+    {
+        LOG_ERROR("Corrupted content archive: {}", path.string());
+        entries_.clear();
+        file_.Close();
+        return false;
+    }
+
+    LOG_INFO("Mounted content archive {} ({} entries)", path.string(), entries_.size());
+    return true;
+}
+
+bool ContentArchive::IsOpen() const
+{
+    return file_.IsOpen();
+}
+
+bool ContentArchive::Contains(const std::string& path) const
+{
+    return entries_.contains(path);
+}
+
+std::optional<std::size_t> ContentArchive::GetSize(const std::string& path) const
+{
+    const auto it = entries_.find(path);
+
+    if (it == entries_.end())
+    {
+        return std::nullopt;
+    }
+
+    return it->second.originalSize;
+}
+
+std::optional<std::span<const std::byte>> ContentArchive::Read(const std::string& path, ContentBuffer& buffer) const
+{
+    const auto it = entries_.find(path);
+
+    if (it == entries_.end())
+    {
+        return std::nullopt;
+    }
+
+    const Entry& entry = it->second;
+
+    if (!entry.compressed)
+    {
+        return entry.data;
+    }
+
+    if (buffer.path != path)
+    {
+        buffer.path.clear();
+        buffer.data.resize(entry.originalSize);
+
+        if (!DecompressLz4(entry.data, buffer.data))
+        {
+            LOG_ERROR("Failed to decompress archive entry: {}", path);
+            buffer.data.clear();
+            return std::nullopt;
+        }
+
+        buffer.path = path;
+    }
+
+    return buffer.data;
+}
\ No newline at end of file
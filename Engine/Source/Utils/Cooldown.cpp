@@ -2,31 +2,43 @@
 
 #include "Utils/Cooldown.h"
 
-#include <SFML/System/Time.hpp>
+#include "Managers/TimeManager.h"
 
 Cooldown::Cooldown(float duration) :
-    duration_(duration)
+    startTime_(TimeManager::GetSceneTime()),
+    duration_(duration),
+    running_(true)
 {
 }
 
 void Cooldown::Start()
 {
-    timer_.start();
+    if (!running_)
+    {
+        startTime_ = TimeManager::GetSceneTime() - stoppedTime_;
+        running_ = true;
+    }
 }
 
 void Cooldown::Stop()
 {
-    timer_.stop();
+    if (running_)
+    {
+        stoppedTime_ = TimeManager::GetSceneTime() - startTime_;
+        running_ = false;
+    }
 }
 
 void Cooldown::Restart()
 {
-    timer_.restart();
+    startTime_ = TimeManager::GetSceneTime();
+    running_ = true;
 }
 
 void Cooldown::Reset()
 {
-    timer_.reset();
+    stoppedTime_ = sf::Time::Zero;
+    running_ = false;
 }
 
 void Cooldown::SetDuration(float duration)
@@ -41,12 +53,12 @@ float Cooldown::GetDuration() const
 
 float Cooldown::GetElapsedTime() const
 {
-    return timer_.getElapsedTime().asSeconds();
+    return (running_ ? TimeManager::GetSceneTime() - startTime_ : stoppedTime_).asSeconds();
 }
 
 bool Cooldown::IsRunning() const
 {
-    return timer_.isRunning();
+    return running_;
 }
 
 bool Cooldown::IsOver() const
@@ -0,0 +1,241 @@
+// Copyright (c) 2025 Adel Hales
+
+#include "Utils/DecodedCache.h"
+
+#include <array>
+#include <cstring>
+#include <format>
+#include <fstream>
+
+#include "Utils/Log.h"
+#include "Utils/MappedFile.h"
+
+namespace
+{
+    constexpr std::uint32_t CACHE_VERSION = 1;
+
+    enum class EntryKind : std::uint32_t
+    {
+        Image,
+        Sound
+    };
+
+    struct EntryHeader
+    {
+        std::array<char, 4> magic = {'A', 'E', 'D', 'C'};
+        std::uint32_t version = CACHE_VERSION;
+        std::uint64_t stamp = 0;
+        EntryKind kind = EntryKind::Image;
+        std::uint32_t channelCount = 0;
+        std::uint32_t width = 0;
+        std::uint32_t height = 0;
+        std::uint32_t sampleRate = 0;
+        std::uint32_t reserved = 0;
+        std::uint64_t count = 0;
+    };
+
+    std::uint64_t Hash(std::span<const std::byte> data, std::uint64_t hash = 14695981039346656037ull)
+    {
+        for (const auto byte : data)
+        {
+            hash = (hash ^ std::uint64_t(byte)) * 1099511628211ull;
+        }
+
+        return hash;
+    }
+
+    template <class T>
+    std::span<const std::byte> AsBytes(const T& value)
+    {
+        return std::as_bytes(std::span(&value, 1));
+    }
+
+    std::shared_ptr<MappedFile> Map(const std::filesystem::path& path, const EntryHeader& expected, EntryHeader& header)
+    {
+        auto file = std::make_shared<MappedFile>();
+
+        if (!file->Open(path) || file->GetData().size() < sizeof(header))
+        {
+            return nullptr;
+        }
+
+        std::memcpy(&header, file->GetData().data(), sizeof(header));
+
+        if (header.magic != expected.magic || header.version != expected.version ||
+            header.stamp != expected.stamp || header.kind != expected.kind)
+        {
+            return nullptr;
+        }
+
+        return file;
+    }
+}
+
+DecodedCache::DecodedCache(const std::filesystem::path& directory) :
+    directory_(directory)
+{
+    std::error_code error;
+    std::filesystem::create_directories(directory_, error);
+}
+
+std::optional<DecodedImage> DecodedCache::FindImage(const std::string& key, const std::filesystem::path& source) const
+{
+    const auto stamp = GetSourceStamp(source);
+
+    if (!stamp)
+    {
+        return std::nullopt;
+    }
+
+    EntryHeader expected;
+    expected.stamp = *stamp;
+    expected.kind = EntryKind::Image;
+
+    EntryHeader header;
+    const auto file = Map(GetEntryPath(key), expected, header);
+
+    // The texture upload reads width * height * 4 bytes, so the blob must hold exactly that many
+    if (!file || header.width == 0 || header.height == 0 ||
+        header.count != std::uint64_t(header.width) * header.height * 4 ||
+        file->GetData().size() - sizeof(header) != header.count)
+    {
+        return std::nullopt;
+    }
+
+    const auto pixels = file->GetData().subspan(sizeof(header));
+
+    return DecodedImage{{header.width, header.height},
+                        {reinterpret_cast<const std::uint8_t*>(pixels.data()), pixels.size()},
+                        file};
+}
+
+std::optional<DecodedSound> DecodedCache::FindSound(const std::string& key, const std::filesystem::path& source) const
+{
+    const auto stamp = GetSourceStamp(source);
+
+    if (!stamp)
+    {
+        return std::nullopt;
+    }
+
+    EntryHeader expected;
+    expected.stamp = *stamp;
+    expected.kind = EntryKind::Sound;
+
+    EntryHeader header;
+    const auto file = Map(GetEntryPath(key), expected, header);
+
+    // Samples are interleaved, so a count that does not split evenly across the channels is corrupt
+    if (!file || header.channelCount == 0 || header.count % header.channelCount != 0)
+    {
+        return std::nullopt;
+    }
+
+    const std::uint64_t mapSize = std::uint64_t(header.channelCount) * sizeof(sf::SoundChannel);
+    const std::uint64_t dataSize = file->GetData().size() - sizeof(header);
+
+    if (mapSize > dataSize || header.count != (dataSize - mapSize) / sizeof(std::int16_t) ||
+        (dataSize - mapSize) % sizeof(std::int16_t) != 0)
+    {
+        return std::nullopt;
+    }
+
+    const auto data = file->GetData().subspan(sizeof(header));
+
+    DecodedSound sound;
+    sound.channelCount = header.channelCount;
+    sound.sampleRate = header.sampleRate;
+    sound.channelMap.resize(header.channelCount);
+    std::memcpy(sound.channelMap.data(), data.data(), mapSize);
+    sound.samples = {reinterpret_cast<const std::int16_t*>(data.data() + mapSize), header.count};
+    sound.storage = file;
+
+    return sound;
+}
+
+void DecodedCache::StoreImage(const std::string& key, const std::filesystem::path& source, const DecodedImage& image) const
+{
+    const auto stamp = GetSourceStamp(source);
+
+    if (!stamp)
+    {
+        return;
+    }
+
+    EntryHeader header;
+    header.stamp = *stamp;
+    header.kind = EntryKind::Image;
+    header.width = image.size.x;
+    header.height = image.size.y;
+    header.count = image.pixels.size();
+
+    const std::array parts = {AsBytes(header), std::as_bytes(image.pixels)};
+    Write(key, parts);
+}
+
+void DecodedCache::StoreSound(const std::string& key, const std::filesystem::path& source, const DecodedSound& sound) const
+{
+    const auto stamp = GetSourceStamp(source);
+
+    if (!stamp)
+    {
+        return;
+    }
+
+    EntryHeader header;
+    header.stamp = *stamp;
+    header.kind = EntryKind::Sound;
+    header.channelCount = sound.channelCount;
+    header.sampleRate = sound.sampleRate;
+    header.count = sound.samples.size();
+
+    // Samples follow the channel map, which keeps them 2-byte aligned within the mapping
+    const std::array parts = {AsBytes(header), std::as_bytes(std::span(sound.channelMap)), std::as_bytes(sound.samples)};
+    Write(key, parts);
+}
+
+std::filesystem::path DecodedCache::GetEntryPath(const std::string& key) const
+{
+    return directory_ / std::format("{:016x}.bin", Hash(std::as_bytes(std::span(key))));
+}
+
+void DecodedCache::Write(const std::string& key, std::span<const std::span<const std::byte>> parts) const
+{
+    const auto path = GetEntryPath(key);
+    auto temporary = path;
+    temporary += ".tmp";
+
+    {
+        std::ofstream file(temporary, std::ios::binary);
+
+        for (const auto part : parts)
+        {
+            file.write(reinterpret_cast<const char*>(part.data()), std::streamsize(part.size()));
+        }
+
+        if (!file)
+        {
+            LOG_WARNING("Failed to write decoded cache entry: {}", key);
+            return;
+        }
+    }
+
+    // Renaming over the old entry means a reader never maps a half-written file
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+}
+
+std::optional<std::uint64_t> DecodedCache::GetSourceStamp(const std::filesystem::path& source)
+{
+    std::error_code timeError;
+    std::error_code sizeError;
+    const auto time = std::filesystem::last_write_time(source, timeError).time_since_epoch().count();
+    const auto size = std::filesystem::file_size(source, sizeError);
+
+    if (timeError || sizeError)
+    {
+        return std::nullopt;
+    }
+
+    return Hash(AsBytes(size), Hash(AsBytes(time)));
+}
\ No newline at end of file
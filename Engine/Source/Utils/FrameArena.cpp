@@ -0,0 +1,63 @@
+// Copyright (c) 2025 Adel Hales
+
+#include "Utils/FrameArena.h"
+
+#include "Utils/Log.h"
+
+FrameArena::FrameArena(std::size_t capacity) :
+    buffer_(std::make_unique<std::byte[]>(capacity)),
+    capacity_(capacity),
+    offset_(0),
+    overflow_(0),
+    peakOverflow_(0),
+    overflowResource_(std::pmr::new_delete_resource())
+{
+}
+
+void FrameArena::Reset()
+{
+    if (overflow_ > peakOverflow_)
+    {
+        peakOverflow_ = overflow_;
+        LOG_WARNING("Frame arena overflowed by {} bytes beyond its {} bytes", overflow_, capacity_);
+    }
+
+    offset_ = 0;
+    overflow_ = 0;
+    overflowResource_.release();
+}
+
+std::size_t FrameArena::GetUsedSize() const
+{
+    return offset_ + overflow_;
+}
+
+std::size_t FrameArena::GetCapacity() const
+{
+    return capacity_;
+}
+
+void* FrameArena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    void* pointer = buffer_.get() + offset_;
+    std::size_t space = capacity_ - offset_;
+
+    if (std::align(alignment, bytes, pointer, space))
+    {
+        offset_ = capacity_ - space + bytes;
+        return pointer;
+    }
+
+    overflow_ += bytes;
+    return overflowResource_.allocate(bytes, alignment);
+}
+
+void FrameArena::do_deallocate(void*, std::size_t, std::size_t)
+{
+    // Everything is released at once by Reset
+}
+
+bool FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
\ No newline at end of file
@@ -2,43 +2,294 @@
 
 #include "Utils/InputBindings.h"
 
+#include <magic_enum/magic_enum.hpp>
+#include <nlohmann/json.hpp>
+
 #include <array>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Utils/Log.h"
 
-namespace Mapping
+namespace
 {
-    const std::array<int, 12> PlayStation = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9,10,11};
-    const std::array<int, 12> Xbox        = {2, 0, 1, 3, 4, 5,-1,-1, 6, 7, 8, 9};
+    const std::string DATABASE_PATH = "Content/Gamepads.json";
+
+    constexpr int NO_BUTTON = -1;
+    constexpr std::size_t LOGICAL_BUTTON_COUNT = magic_enum::enum_count<GamepadButton>();
+
+    using Layout = std::array<int, LOGICAL_BUTTON_COUNT>;
+
+    // Identity layout used until the database is loaded or when it names no default
+    constexpr Layout DEFAULT_LAYOUT = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+    struct Database
+    {
+        std::vector<Layout> layouts = {DEFAULT_LAYOUT};
+        std::vector<std::string> names = {"Default"};
+        std::unordered_map<std::uint32_t, std::size_t> products;
+        std::unordered_map<std::uint32_t, std::size_t> vendors;
+        std::size_t defaultLayout = 0;
+    };
+
+    // Both directions are resolved when the gamepad is identified so lookups are a single index
+    struct Mapping
+    {
+        std::array<int, LOGICAL_BUTTON_COUNT> logicalToHardware = {};
+        std::array<int, sf::Joystick::ButtonCount> hardwareToLogical = {};
+        bool identified = false;
+    };
+
+    Database database;
+    std::array<Mapping, sf::Joystick::Count> gamepads;
+
+    std::uint32_t MakeProductKey(unsigned int vendorId, unsigned int productId)
+    {
+        return (vendorId & 0xFFFF) << 16 | (productId & 0xFFFF);
+    }
+
+    std::size_t FindLayout(const sf::Joystick::Identification& identification)
+    {
+        if (const auto product = database.products.find(MakeProductKey(identification.vendorId, identification.productId)); product != database.products.end())
+        {
+            return product->second;
+        }
+
+        if (const auto vendor = database.vendors.find(identification.vendorId); vendor != database.vendors.end())
+        {
+            return vendor->second;
+        }
+
+        return database.defaultLayout;
+    }
+
+    const Mapping& GetMapping(int id)
+    {
+        auto& mapping = gamepads[id];
+
+        if (!mapping.identified)
+        {
+            Input::RefreshGamepad(id);
+        }
+
+        return mapping;
+    }
+
+    bool IsValidGamepad(int id)
+    {
+        return id >= 0 && id < (int)sf::Joystick::Count;
+    }
+
+    // Missing or mistyped fields read as empty, so that one bad entry is skipped instead of throwing
+    std::optional<std::string> GetString(const nlohmann::json& json, const char* key)
+    {
+        const auto it = json.find(key);
+        return (it != json.end() && it->is_string()) ? std::optional(it->get<std::string>()) : std::nullopt;
+    }
+
+    std::optional<unsigned int> GetUnsigned(const nlohmann::json& json, const char* key)
+    {
+        const auto it = json.find(key);
+        return (it != json.end() && it->is_number_unsigned()) ? std::optional(it->get<unsigned int>()) : std::nullopt;
+    }
+
+    void ParseLayouts(const nlohmann::json& json, std::unordered_map<std::string, std::size_t>& indices)
+    {
+        const auto layouts = json.find("layouts");
+
+        if (layouts == json.end() || !layouts->is_object())
+        {
+            return;
+        }
+
+        for (const auto& [name, buttons] : layouts->items())
+        {
+            if (!buttons.is_object())
+            {
+                LOG_WARNING("Gamepad layout '{}' is not an object", name);
+                continue;
+            }
+
+            Layout layout;
+            layout.fill(NO_BUTTON);
+
+            for (const auto& [button, hardware] : buttons.items())
+            {
+                const auto logical = magic_enum::enum_cast<GamepadButton>(button);
+
+                if (!logical)
+                {
+                    LOG_WARNING("Unknown gamepad button '{}' in layout '{}'", button, name);
+                    continue;
+                }
+
+                // Hardware indices end up indexing the reverse mapping, which only holds ButtonCount entries
+                if (!hardware.is_number_integer() || hardware.get<std::int64_t>() < 0 ||
+                    hardware.get<std::int64_t>() >= (std::int64_t)sf::Joystick::ButtonCount)
+                {
+                    LOG_WARNING("Invalid hardware button {} for '{}' in layout '{}'", hardware.dump(), button, name);
+                    continue;
+                }
 
-    //const int SonyVID    = 0x054C;
-    const int MicrosoftVID = 0x045E;
+                layout[(std::size_t)*logical] = hardware.get<int>();
+            }
 
-    const auto& GetMapping(int id)
+            indices[name] = database.layouts.size();
+            database.layouts.push_back(layout);
+            database.names.push_back(name);
+        }
+    }
+
+    std::size_t ParseDevices(const nlohmann::json& json, const std::unordered_map<std::string, std::size_t>& indices)
     {
-        const int vendorId = sf::Joystick::getIdentification(id).vendorId;
-        return (vendorId == MicrosoftVID) ? Xbox : PlayStation;
+        const auto devices = json.find("devices");
+        std::size_t count = 0;
+
+        if (devices == json.end() || !devices->is_array())
+        {
+            return count;
+        }
+
+        for (const auto& device : *devices)
+        {
+            const auto name = GetString(device, "layout");
+            const auto vendorId = GetUnsigned(device, "vendor");
+
+            if (!name || !vendorId)
+            {
+                LOG_WARNING("Gamepad device without a layout or vendor: {}", device.dump());
+                continue;
+            }
+
+            const auto layout = indices.find(*name);
+
+            if (layout == indices.end())
+            {
+                LOG_WARNING("Unknown gamepad layout '{}'", *name);
+                continue;
+            }
+
+            if (const auto productId = GetUnsigned(device, "product"))
+            {
+                database.products[MakeProductKey(*vendorId, *productId)] = layout->second;
+            }
+            else
+            {
+                database.vendors[*vendorId] = layout->second;
+            }
+
+            count++;
+        }
+
+        return count;
     }
 }
 
-std::optional<int> Input::LogicalToHardware(GamepadButton button, int id)
+void Input::LoadGamepadDatabase()
 {
-    const auto& mapping = Mapping::GetMapping(id);
+    std::ifstream file(DATABASE_PATH);
+
+    if (!file)
+    {
+        LOG_WARNING("Gamepad database not found: {}", DATABASE_PATH);
+        return;
+    }
+
+    const nlohmann::json json = nlohmann::json::parse(file, nullptr, false);
+
+    database = {};
 
-    const int value = mapping[(int)button];
+    // Layouts may have changed under gamepads that were already identified
+    for (auto& mapping : gamepads)
+    {
+        mapping.identified = false;
+    }
+
+    if (json.is_discarded() || !json.is_object())
+    {
+        LOG_WARNING("Gamepad database is malformed, using the default layout: {}", DATABASE_PATH);
+        return;
+    }
+
+    std::unordered_map<std::string, std::size_t> indices;
+    ParseLayouts(json, indices);
+
+    if (const auto name = GetString(json, "defaultLayout"))
+    {
+        if (const auto layout = indices.find(*name); layout != indices.end())
+        {
+            database.defaultLayout = layout->second;
+        }
+    }
 
-    return (value != -1) ? std::optional(value) : std::nullopt;
+    const std::size_t deviceCount = ParseDevices(json, indices);
+
+    LOG_INFO("Gamepad database loaded: {} layouts, {} devices", database.layouts.size(), deviceCount);
 }
 
-std::optional<GamepadButton> Input::HardwareToLogical(int button, int id)
+void Input::RefreshGamepad(int id)
 {
-    const auto& mapping = Mapping::GetMapping(id);
+    if (!IsValidGamepad(id))
+    {
+        return;
+    }
+
+    const auto identification = sf::Joystick::getIdentification(id);
+
+    const std::size_t index = FindLayout(identification);
+    const Layout& layout = database.layouts[index];
+
+    auto& mapping = gamepads[id];
+    mapping.logicalToHardware = layout;
+    mapping.hardwareToLogical.fill(NO_BUTTON);
 
-    for (std::size_t i = 0; i < mapping.size(); i++)
+    for (std::size_t i = 0; i < layout.size(); i++)
     {
-        if (mapping[i] == button)
+        if (layout[i] >= 0 && layout[i] < (int)sf::Joystick::ButtonCount)
         {
-            return GamepadButton(i);
+            mapping.hardwareToLogical[layout[i]] = (int)i;
         }
     }
 
-    return std::nullopt;
+    mapping.identified = true;
+
+    if (sf::Joystick::isConnected(id))
+    {
+        LOG_INFO("Gamepad {} uses the {} layout ({:04X}:{:04X})", id, database.names[index], identification.vendorId, identification.productId);
+    }
+}
+
+void Input::ForgetGamepad(int id)
+{
+    if (IsValidGamepad(id))
+    {
+        gamepads[id].identified = false;
+    }
+}
+
+std::optional<int> Input::LogicalToHardware(GamepadButton button, int id)
+{
+    if (!IsValidGamepad(id))
+    {
+        return std::nullopt;
+    }
+
+    const int value = GetMapping(id).logicalToHardware[(std::size_t)button];
+
+    return (value != NO_BUTTON) ? std::optional(value) : std::nullopt;
+}
+
+std::optional<GamepadButton> Input::HardwareToLogical(int button, int id)
+{
+    if (!IsValidGamepad(id) || button < 0 || button >= (int)sf::Joystick::ButtonCount)
+    {
+        return std::nullopt;
+    }
+
+    const int value = GetMapping(id).hardwareToLogical[button];
+
+    return (value != NO_BUTTON) ? std::optional(GamepadButton(value)) : std::nullopt;
 }
\ No newline at end of file
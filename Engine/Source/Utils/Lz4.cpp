@@ -0,0 +1,183 @@
+// Copyright (c) 2025 Adel Hales
+
+#include "Utils/Lz4.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+    constexpr std::size_t MIN_MATCH = 4;
+    constexpr std::size_t LAST_LITERALS = 5;
+    constexpr std::size_t MATCH_SAFE_DISTANCE = 12;
+    constexpr std::size_t MAX_OFFSET = 65535;
+    constexpr int HASH_BITS = 12;
+
+    std::uint32_t Read32(const std::byte* data)
+    {
+        std::uint32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    void WriteLength(std::vector<std::byte>& output, std::size_t length)
+    {
+        for (; length >= 255; length -= 255)
+        {
+            output.push_back(std::byte(255));
+        }
+
+        output.push_back(std::byte(length));
+    }
+
+    bool ReadLength(std::span<const std::byte> source, std::size_t& position, std::size_t& length)
+    {
+        std::uint8_t value;
+
+        do
+        {
+            if (position >= source.size())
+            {
+                return false;
+            }
+
+            value = std::uint8_t(source[position++]);
+            length += value;
+        } while (value == 255);
+
+        return true;
+    }
+
+    void WriteSequence(std::vector<std::byte>& output, std::span<const std::byte> literals, std::size_t offset, std::size_t matchLength)
+    {
+        const std::size_t literalToken = std::min<std::size_t>(literals.size(), 15);
+        const std::size_t matchToken = (matchLength > 0) ? std::min<std::size_t>(matchLength - MIN_MATCH, 15) : 0;
+
+        output.push_back(std::byte((literalToken << 4) | matchToken));
+
+        if (literalToken == 15)
+        {
+            WriteLength(output, literals.size() - 15);
+        }
+
+        output.insert(output.end(), literals.begin(), literals.end());
+
+        // The last sequence of a block carries literals only
+        if (matchLength > 0)
+        {
+            output.push_back(std::byte(offset & 0xFF));
+            output.push_back(std::byte(offset >> 8));
+
+            if (matchToken == 15)
+            {
+                WriteLength(output, matchLength - MIN_MATCH - 15);
+            }
+        }
+    }
+}
+
+std::vector<std::byte> CompressLz4(std::span<const std::byte> source)
+{
+    std::vector<std::byte> output;
+    output.reserve(source.size() + source.size() / 255 + 16);
+
+    // Positions are stored off by one so that zero means an empty slot
+    std::array<std::uint32_t, 1 << HASH_BITS> table{};
+    std::size_t anchor = 0;
+    std::size_t position = 0;
+
+    const std::size_t matchLimit = (source.size() > MATCH_SAFE_DISTANCE) ? source.size() - MATCH_SAFE_DISTANCE : 0;
+
+    while (position < matchLimit)
+    {
+        const std::uint32_t sequence = Read32(&source[position]);
+        const std::uint32_t hash = (sequence * 2654435761u) >> (32 - HASH_BITS);
+        const std::size_t candidate = table[hash];
+        table[hash] = std::uint32_t(position + 1);
+
+        if (candidate == 0 || position - (candidate - 1) > MAX_OFFSET || Read32(&source[candidate - 1]) != sequence)
+        {
+            position++;
+            continue;
+        }
+
+        const std::size_t match = candidate - 1;
+        std::size_t length = MIN_MATCH;
+
+        while (position + length < source.size() - LAST_LITERALS && source[match + length] == source[position + length])
+        {
+            length++;
+        }
+
+        WriteSequence(output, source.subspan(anchor, position - anchor), position - match, length);
+
+        position += length;
+        anchor = position;
+    }
+
+    WriteSequence(output, source.subspan(anchor), 0, 0);
+
+    return output;
+}
+
+bool DecompressLz4(std::span<const std::byte> source, std::span<std::byte> destination)
+{
+    std::size_t input = 0;
+    std::size_t output = 0;
+
+    while (input < source.size())
+    {
+        const auto token = std::uint8_t(source[input++]);
+
+        std::size_t literals = token >> 4;
+
+        if (literals == 15 && !ReadLength(source, input, literals))
+        {
+            return false;
+        }
+
+        if (literals > source.size() - input || literals > destination.size() - output)
+        {
+            return false;
+        }
+
+        std::memcpy(destination.data() + output, source.data() + input, literals);
+        input += literals;
+        output += literals;
+
+        if (input == source.size())
+        {
+            break;
+        }
+
+        if (source.size() - input < 2)
+        {
+            return false;
+        }
+
+        const std::size_t offset = std::size_t(source[input]) | (std::size_t(source[input + 1]) << 8);
+        input += 2;
+
+        std::size_t length = (token & 0xF) + MIN_MATCH;
+
+        if ((token & 0xF) == 15 && !ReadLength(source, input, length))
+        {
+            return false;
+        }
+
+        if (offset == 0 || offset > output || length > destination.size() - output)
+        {
+            return false;
+        }
+
+        // Matches may overlap their own output, so the copy has to go forward byte by byte
+        for (std::size_t i = 0; i < length; i++, output++)
+        {
+            destination[output] = destination[output - offset];
+        }
+    }
+
+    return output == destination.size();
+}
\ No newline at end of file
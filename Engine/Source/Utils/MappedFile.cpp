@@ -0,0 +1,96 @@
+// Copyright (c) 2025 Adel Hales
+
+#include "Utils/MappedFile.h"
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open(const std::filesystem::path& path)
+{
+    Close();
+
+#ifdef _WIN32
+    const HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    const HANDLE mapping = GetFileSizeEx(file, &size) && size.QuadPart > 0 ? CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+
+    // The view keeps the mapping alive, so both handles can be closed right away
+    if (mapping)
+    {
+        data_ = static_cast<const std::byte*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        size_ = data_ ? std::size_t(size.QuadPart) : 0;
+        CloseHandle(mapping);
+    }
+
+    CloseHandle(file);
+#else
+    const int file = open(path.c_str(), O_RDONLY);
+
+    if (file < 0)
+    {
+        return false;
+    }
+
+    struct stat status;
+
+    if (fstat(file, &status) == 0 && status.st_size > 0)
+    {
+        void* data = mmap(nullptr, std::size_t(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+        if (data != MAP_FAILED)
+        {
+            data_ = static_cast<const std::byte*>(data);
+            size_ = std::size_t(status.st_size);
+        }
+    }
+
+    // The mapping outlives the descriptor
+    close(file);
+#endif
+
+    return IsOpen();
+}
+
+void MappedFile::Close()
+{
+    if (data_)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(data_);
+#else
+        munmap(const_cast<std::byte*>(data_), size_);
+#endif
+    }
+
+    data_ = nullptr;
+    size_ = 0;
+}
+
+bool MappedFile::IsOpen() const
+{
+    return data_ != nullptr;
+}
+
+std::span<const std::byte> MappedFile::GetData() const
+{
+    return {data_, size_};
+}
\ No newline at end of file
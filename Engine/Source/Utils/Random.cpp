@@ -0,0 +1,154 @@
+// Copyright (c) 2025 Adel Hales
+
+#include "Utils/Random.h"
+
+namespace
+{
+    const std::array<std::uint64_t, 4> JUMP_POLYNOMIAL = {
+        0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C
+    };
+
+    const std::array<std::uint64_t, 4> LONG_JUMP_POLYNOMIAL = {
+        0x76E15D3EFEFDCBBF, 0xC5004E441C522FB3, 0x77710069854EE241, 0x39109BB02ACBE635
+    };
+
+    std::uint64_t SplitMix64(std::uint64_t& state)
+    {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+        return z ^ (z >> 31);
+    }
+
+    // 24 random bits are all a float mantissa can hold, this maps them to [0, 1)
+    float ToUnitFloat(std::uint64_t bits)
+    {
+        return float(bits & 0xFFFFFF) * 0x1.0p-24f;
+    }
+}
+
+Random::Random(std::uint64_t seed)
+{
+    // SplitMix64 spreads any seed, including 0, into a state that is never all zeros
+    for (auto& word : state_)
+    {
+        word = SplitMix64(seed);
+    }
+}
+
+void Random::Jump()
+{
+    Jump(JUMP_POLYNOMIAL);
+}
+
+void Random::LongJump()
+{
+    Jump(LONG_JUMP_POLYNOMIAL);
+}
+
+void Random::Jump(const std::array<std::uint64_t, 4>& polynomial)
+{
+    std::array<std::uint64_t, 4> state = {};
+
+    for (std::uint64_t word : polynomial)
+    {
+        for (int bit = 0; bit < 64; bit++)
+        {
+            if (word & (std::uint64_t(1) << bit))
+            {
+                for (std::size_t i = 0; i < state.size(); i++)
+                {
+                    state[i] ^= state_[i];
+                }
+            }
+
+            (*this)();
+        }
+    }
+
+    state_ = state;
+}
+
+Random Random::Split()
+{
+    Random worker = *this;
+    Jump();
+    return worker;
+}
+
+int Random::Int(int min, int max)
+{
+    // Lemire's multiply and reject, unbiased without a division in the common case
+    const std::uint32_t range = std::uint32_t(max) - std::uint32_t(min) + 1;
+
+    if (range == 0)
+    {
+        return int((*this)() >> 32);
+    }
+
+    std::uint64_t product = ((*this)() >> 32) * range;
+
+    if (std::uint32_t(product) < range)
+    {
+        const std::uint32_t threshold = (0u - range) % range;
+
+        while (std::uint32_t(product) < threshold)
+        {
+            product = ((*this)() >> 32) * range;
+        }
+    }
+
+    return int(std::uint32_t(min) + std::uint32_t(product >> 32));
+}
+
+float Random::Float(float min, float max)
+{
+    return min + (max - min) * ToUnitFloat((*this)() >> 40);
+}
+
+bool Random::Bool(float probability)
+{
+    return ToUnitFloat((*this)() >> 40) < probability;
+}
+
+sf::Vector2f Random::Position(sf::Vector2f min, sf::Vector2f max)
+{
+    return {Float(min.x, max.x), Float(min.y, max.y)};
+}
+
+sf::Angle Random::Angle(sf::Angle min, sf::Angle max)
+{
+    return sf::degrees(Float(min.asDegrees(), max.asDegrees()));
+}
+
+sf::Color Random::Color(sf::Color min, sf::Color max)
+{
+    return {(std::uint8_t)Int(min.r, max.r), (std::uint8_t)Int(min.g, max.g), (std::uint8_t)Int(min.b, max.b)};
+}
+
+void Random::Fill(std::span<int> values, int min, int max)
+{
+    for (int& value : values)
+    {
+        value = Int(min, max);
+    }
+}
+
+void Random::Fill(std::span<float> values, float min, float max)
+{
+    const float range = max - min;
+    std::size_t i = 0;
+
+    // Each draw carries enough bits for two floats
+    for (; i + 1 < values.size(); i += 2)
+    {
+        const std::uint64_t bits = (*this)();
+        values[i] = min + range * ToUnitFloat(bits >> 40);
+        values[i + 1] = min + range * ToUnitFloat(bits >> 8);
+    }
+
+    if (i < values.size())
+    {
+        values[i] = Float(min, max);
+    }
+}
\ No newline at end of file
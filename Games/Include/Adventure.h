@@ -13,12 +13,17 @@ namespace Adventure
     private:
         Player player;
         Camera camera;
-        std::vector<Bullet> bullets;
-        std::vector<Enemy> enemies;
+        Pool<Bullet, BULLET_CAPACITY> bullets;
+        Pool<Enemy, ENEMY_CAPACITY> enemies;
         TileMap map;
+        ResourceHandle<sf::Texture> tilesetTexture;
+        ResourceHandle<sf::Texture> playerTexture;
+        std::optional<AnimationClip> playerAnimation;
+        ResourceHandle<sf::Texture> enemyTexture;
         Cooldown enemySpawnCooldown;
-        sf::Sound bonusSound;
+        ResourceHandle<sf::Texture> backgroundTexture;
         sf::RectangleShape background;
+        ResourceHandle<sf::SoundBuffer> bonusSound;
 
     public:
         Game(EngineContext&);
@@ -26,12 +31,13 @@ namespace Adventure
         void Start();
         void Update();
         void Render() const;
-        void OnPause(bool);
+        bool IsOpaque() const;
+        ResourceManifest GetManifest() const;
+        void OnCleanup();
 
     private:
         void InitPlayer();
         void InitCamera();
-        void InitSounds();
         void InitBackground();
 
         void BindInputs();
@@ -39,6 +45,7 @@ namespace Adventure
         void StartMap();
         void StartPlayer();
         void StartCamera();
+        void StartBackground();
 
         void UpdatePlayer();
         void UpdatePlayerDirection();
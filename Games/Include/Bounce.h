@@ -13,8 +13,9 @@ namespace Bounce
         std::vector<Ball> balls;
         Cooldown ballSpawnCooldown;
         Stats stats;
+        ResourceHandle<sf::Texture> backgroundTexture;
         sf::RectangleShape background;
-        sf::Sound bounceSound;
+        ResourceHandle<sf::SoundBuffer> bounceSound;
         sf::Music music;
 
     public:
@@ -23,6 +24,8 @@ namespace Bounce
         void Start();
         void Update();
         void Render() const;
+        bool IsOpaque() const;
+        ResourceManifest GetManifest() const;
         void OnPause(bool);
         void OnCleanup();
 
@@ -30,13 +33,13 @@ namespace Bounce
         void InitPaddle();
         void InitStats();
         void InitBackground();
-        void InitBounceSound();
         void InitMusic();
 
         void BindInputs();
 
         void StartPaddle();
         void StartStats();
+        void StartBackground();
         void StartMusic();
 
         void UpdatePaddle();
@@ -9,8 +9,9 @@ namespace Breakout
     class Game : public Scene
     {
     private:
+        ResourceHandle<sf::Texture> playerTexture;
         Player player;
-        std::vector<Ball> balls;
+        Pool<Ball, BALL_CAPACITY> balls;
         std::vector<Brick> bricks;
         std::vector<Bonus> bonuses;
 
@@ -20,7 +21,8 @@ namespace Breakout
         void Start();
         void Update();
         void Render() const;
-        void OnPause(bool);
+        ResourceManifest GetManifest() const;
+        void OnCleanup();
 
     private:
         void InitPlayer();
@@ -49,7 +51,7 @@ namespace Breakout
         void ResolveCollisionBallBrick(Ball& ball, Brick& brick);
         void ResolveCollisionBallBrickBounce(Ball& ball, Brick& brick);
 
-        std::vector<BonusType> GetBonusTypesAllowed() const;
+        std::pmr::vector<BonusType> GetBonusTypesAllowed() const;
         bool IsBonusCompatible(BonusType a, BonusType b) const;
         bool IsBallNearPlayer(const Ball& ball) const;
     };
@@ -9,6 +9,7 @@ namespace Clicker
     class Game : public Scene
     {
     private:
+        ResourceHandle<sf::Texture> targetTexture;
         Target target;
         Stats stats;
 
@@ -18,7 +19,8 @@ namespace Clicker
         void Start();
         void Update();
         void Render() const;
-        void OnPause(bool);
+        ResourceManifest GetManifest() const;
+        void OnCleanup();
 
     private:
         void InitTarget();
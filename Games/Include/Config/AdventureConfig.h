@@ -25,6 +25,7 @@ namespace Adventure
 
     const float BULLET_RADIUS = 1;
     const float BULLET_SPEED = 150;
+    const std::size_t BULLET_CAPACITY = 64;
 
     const int ENEMY_LIVES = 3;
     const float ENEMY_SPEED = 20;
@@ -32,9 +33,11 @@ namespace Adventure
     const float ENEMY_KNOCKBACK_COOLDOWN_DURATION = 0.5f;
     const float ENEMY_SPAWN_RADIUS = 300;
     const float ENEMY_SPAWN_COOLDOWN_DURATION = 5;
+    const std::size_t ENEMY_CAPACITY = 64;
 
     const int BONUS_GOAL = 20;
     const float BONUS_SOUND_VOLUME = 20;
+    const int BONUS_SOUND_PRIORITY = 1;
 
     const sf::Color PLAYER_COLOR(200, 200, 200);
     const sf::Color PLAYER_FORCE_FIELD_COLOR(70, 130, 180, 50);
@@ -43,10 +46,10 @@ namespace Adventure
     const sf::Color STATS_TEXT_COLOR(200, 200, 200);
     const sf::Color BACKGROUND_COLOR(110, 110, 110);
 
-    const std::string PLAYER_TEXTURE_FILENAME = "SpriteSheet.png";
-    const std::string ENEMY_TEXTURE_FILENAME = "Enemy.png";
-    const std::string TILEMAP_LEVEL_FILENAME = "Adventure.txt";
-    const std::string TILEMAP_TEXTURE_FILENAME = "TileMap.png";
-    const std::string BACKGROUND_TEXTURE_FILENAME = "LandscapeBackground.png";
-    const std::string BONUS_SOUND_FILENAME = "Bonus.mp3";
+    const TextureId PLAYER_TEXTURE = TextureId::SpriteSheet;
+    const TextureId ENEMY_TEXTURE = TextureId::Enemy;
+    const std::string TILEMAP_LEVEL_FILENAME = "Adventure.map";
+    const TextureId TILEMAP_TEXTURE = TextureId::TileMap;
+    const TextureId BACKGROUND_TEXTURE = TextureId::LandscapeBackground;
+    const SoundId BONUS_SOUND = SoundId::Bonus;
 }
\ No newline at end of file
@@ -18,6 +18,7 @@ namespace Bounce
     const float MUSIC_PITCH = 1;
 
     const float BOUNCE_SOUND_VOLUME = 10;
+    const int BOUNCE_SOUND_PRIORITY = 0;
 
     const sf::Color PADDLE_COLOR(sf::Color::Green);
     const sf::Color BALL_COLOR(sf::Color::Cyan);
@@ -25,9 +26,9 @@ namespace Bounce
     const sf::Color STATS_HIGH_SCORE_TEXT_COLOR(sf::Color::Yellow);
     const sf::Color STATS_LIVES_TEXT_COLOR(sf::Color::Red);
 
-    const std::string MUSIC_FILENAME = "Music.mp3";
-    const std::string BOUNCE_SOUND_FILENAME = "Bonus.mp3";
-    const std::string BACKGROUND_TEXTURE_FILENAME = "PurpleBackground.png";
+    const MusicId MUSIC = MusicId::Music;
+    const SoundId BOUNCE_SOUND = SoundId::Bonus;
+    const TextureId BACKGROUND_TEXTURE = TextureId::PurpleBackground;
 
     const std::string_view STATS_HIGH_SCORE_KEY = "Bounce:High Score";
 }
\ No newline at end of file
@@ -13,6 +13,7 @@ namespace Breakout
     const float BALL_SPEED = 650;
     const sf::Angle BALL_ANGLE_MAX = sf::degrees(60);
     const float BALL_MAGNET_RANGE = 300;
+    const std::size_t BALL_CAPACITY = 16;
 
     const sf::Vector2i BRICK_MAP_SIZE(10, 7);
     const int BRICK_LIVES_MAX = 3;
@@ -30,5 +31,5 @@ namespace Breakout
         {120, 220, 250}, {0, 128, 128}, {0, 71, 171}, {18, 10, 143}
     };
 
-    const std::string PLAYER_TEXTURE_FILENAME = "Paddle.png";
+    const TextureId PLAYER_TEXTURE = TextureId::Paddle;
 }
\ No newline at end of file
@@ -20,7 +20,7 @@ namespace Clicker
     const sf::Color STATS_FINAL_COOLDOWN_TEXT_COLOR(sf::Color::Red);
     const sf::Color STATS_BEST_TIME_TEXT_COLOR(sf::Color::Yellow);
 
-    const std::string TARGET_TEXTURE_FILENAME = "Target.png";
+    const TextureId TARGET_TEXTURE = TextureId::Target;
 
     const std::string_view STATS_BEST_TIME_KEY = "Clicker:Best Time";
 }
\ No newline at end of file
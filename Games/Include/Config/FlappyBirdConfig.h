@@ -23,10 +23,12 @@ namespace FlappyBird
     const float OBSTACLE_GAP_MIN = 125;
     const float OBSTACLE_GAP_MAX = 175;
 
+    const std::vector<float> TIME_SCALES = {1, 4, 16, 64};
+
     const sf::Color STATS_TEXT_COLOR(175, 175, 175);
     const sf::Color BACKGROUND_COLOR(110, 110, 110);
 
-    const std::string BIRD_TEXTURE_FILENAME = "Bird.png";
-    const std::string PIPE_TEXTURE_FILENAME = "Pipe.png";
-    const std::string BACKGROUND_TEXTURE_FILENAME = "LandscapeBackground.png";
+    const TextureId BIRD_TEXTURE = TextureId::Bird;
+    const TextureId PIPE_TEXTURE = TextureId::Pipe;
+    const TextureId BACKGROUND_TEXTURE = TextureId::LandscapeBackground;
 }
\ No newline at end of file
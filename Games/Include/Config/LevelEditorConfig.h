@@ -19,7 +19,7 @@ namespace LevelEditor
     const sf::Color INFOS_COLOR(200, 200, 200);
     const sf::Color BACKGROUND_COLOR(110, 110, 110);
 
-    const std::string TILEMAP_LEVEL_FILENAME = "Adventure.txt";
-    const std::string TILEMAP_TEXTURE_FILENAME = "TileMap.png";
-    const std::string BACKGROUND_TEXTURE_FILENAME = "LandscapeBackground.png";
+    const std::string TILEMAP_LEVEL_FILENAME = "Adventure.map";
+    const TextureId TILEMAP_TEXTURE = TextureId::TileMap;
+    const TextureId BACKGROUND_TEXTURE = TextureId::LandscapeBackground;
 }
\ No newline at end of file
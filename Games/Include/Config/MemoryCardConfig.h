@@ -19,5 +19,5 @@ namespace MemoryCard
         sf::Color::Magenta, sf::Color::Yellow, sf::Color::Cyan,
     };
 
-    const std::string CARD_TEXTURE_FILENAME = "Card.png";
+    const TextureId CARD_TEXTURE = TextureId::Card;
 }
\ No newline at end of file
@@ -30,8 +30,8 @@ namespace Menu
     const sf::Color CONTROLS_TEXT_COLOR(175, 175, 175);
     const sf::Color CONTROLS_BACKGROUND_COLOR(0, 0, 0, 225);
 
-    const std::string BUTTON_TEXTURE_FILENAME = "Button.png";
-    const std::string MUSIC_FILENAME = "Music.mp3";
+    const TextureId BUTTON_TEXTURE = TextureId::Button;
+    const MusicId MUSIC = MusicId::Music;
 
     const std::array CONTROLS_TEXTS =
     {
@@ -22,8 +22,10 @@ namespace MineStorm
     const float ENEMY_SPEED = 40;
     const int ENEMY_CHILD_COUNT = 2;
     const int ENEMY_COUNT = 4;
+    const std::size_t ENEMY_CAPACITY = 32;
     const float ENEMY_BULLET_RADIUS = 5;
     const float ENEMY_BULLET_SPEED = 150;
+    const std::size_t BULLET_CAPACITY = 64;
 
     const float EXPLOSION_SCALE = 3;
     const float EXPLOSION_ANIMATION_DURATION = 1.5f / 48;
@@ -56,8 +58,8 @@ namespace MineStorm
         {255, 170, 120}, {255, 60, 225}, {0, 255, 255}, {150, 255, 30}
     };
 
-    const std::string PLAYER_TEXTURE_FILENAME = "Spaceship.png";
-    const std::string EXPLOSION_TEXTURE_FILENAME = "Explosion.png";
-    const std::string BACKGROUND_TEXTURE_FILENAME = "PurpleBackground.png";
-    const std::string FOREGROUND_TEXTURE_FILENAME = "MinestormForeground.png";
+    const TextureId PLAYER_TEXTURE = TextureId::Spaceship;
+    const TextureId EXPLOSION_TEXTURE = TextureId::Explosion;
+    const TextureId BACKGROUND_TEXTURE = TextureId::PurpleBackground;
+    const TextureId FOREGROUND_TEXTURE = TextureId::MinestormForeground;
 }
\ No newline at end of file
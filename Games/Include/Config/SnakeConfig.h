@@ -12,6 +12,7 @@ namespace Snake
     const int STATS_SCORE_GOAL = 50;
 
     const float BONUS_SOUND_VOLUME = 20;
+    const int BONUS_SOUND_PRIORITY = 1;
 
     const sf::Vector2i MAP_SIZE(12, 12);
 
@@ -21,6 +22,6 @@ namespace Snake
     const sf::Color MAP_COLOR(50, 100, 50);
     const sf::Color MAP_OUTLINE_COLOR(sf::Color::Black);
 
-    const std::string TILEMAP_TEXTURE_FILENAME = "Snake.png";
-    const std::string BONUS_SOUND_FILENAME = "Bonus.mp3";
+    const TextureId TILEMAP_TEXTURE = TextureId::Snake;
+    const SoundId BONUS_SOUND = SoundId::Bonus;
 }
\ No newline at end of file
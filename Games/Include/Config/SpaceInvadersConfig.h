@@ -21,6 +21,8 @@ namespace SpaceInvaders
     const float ENEMY_BULLET_RADIUS = 5;
     const float ENEMY_BULLET_SPEED = 500;
 
+    const std::size_t BULLET_CAPACITY = 64;
+
     const int BUNKER_COUNT = 4;
     const sf::Vector2f BUNKER_SIZE(50, 50);
     const sf::Vector2i BUNKER_PART_COUNT(10, 10);
@@ -36,8 +38,8 @@ namespace SpaceInvaders
     const sf::Color ENEMY_BULLET_COLOR(255, 0, 50);
     const sf::Color BUNKER_COLOR(122, 138, 154);
 
-    const std::string PLAYER_TEXTURE_FILENAME = "Spaceship.png";
-    const std::string ENEMY_1_TEXTURE_FILENAME = "Alien_1.png";
-    const std::string ENEMY_2_TEXTURE_FILENAME = "Alien_2.png";
-    const std::string ENEMY_3_TEXTURE_FILENAME = "Alien_3.png";
+    const TextureId PLAYER_TEXTURE = TextureId::Spaceship;
+    const TextureId ENEMY_1_TEXTURE = TextureId::Alien_1;
+    const TextureId ENEMY_2_TEXTURE = TextureId::Alien_2;
+    const TextureId ENEMY_3_TEXTURE = TextureId::Alien_3;
 }
\ No newline at end of file
@@ -11,6 +11,8 @@ namespace TowerDefense
     const int STATS_BASE_MONEY = 25;
     const int STATS_BASE_LEVEL = 0;
 
+    const std::vector<float> TIME_SCALES = {1, 2, 4, 8};
+
     const int WAVE_MONEY_BONUS = 10;
     const float WAVE_SPAWN_COOLDOWN_DURATION = 3;
 
@@ -26,9 +28,11 @@ namespace TowerDefense
     const int ENEMY_HEALTH = 90;
     const int ENEMY_DAMAGE = 25;
     const float ENEMY_SPAWN_COOLDOWN_DURATION = 2;
+    const std::size_t ENEMY_CAPACITY = 128;
 
     const float BULLET_SPEED = 500;
     const int BULLET_DAMAGE = 5;
+    const std::size_t BULLET_CAPACITY = 256;
     
     const float HEALTH_BAR_HEIGHT = 5;
 
@@ -48,6 +52,6 @@ namespace TowerDefense
         {255, 69, 0}, {138, 43, 226}, {0, 255, 64},
     };
 
-    const std::string CASTLE_TEXTURE_FILENAME = "Castle.png";
-    const std::string ENEMY_TEXTURE_FILENAME = "Spaceship.png";
+    const TextureId CASTLE_TEXTURE = TextureId::Castle;
+    const TextureId ENEMY_TEXTURE = TextureId::Spaceship;
 }
\ No newline at end of file
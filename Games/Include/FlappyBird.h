@@ -9,18 +9,24 @@ namespace FlappyBird
     class Game : public Scene
     {
     private:
+        ResourceHandle<sf::Texture> birdTexture;
+        ResourceHandle<sf::Texture> pipeTexture;
         Generation generation;
         std::vector<Obstacle> obstacles;
-        sf::Clock clock;
+        Cooldown generationTimer;
+        ResourceHandle<sf::Texture> backgroundTexture;
         sf::RectangleShape background;
 
     public:
         Game(EngineContext&);
 
         void Start();
+        void OnEvent(const sf::Event&);
         void Update();
         void Render() const;
-        void OnPause(bool);
+        bool IsOpaque() const;
+        ResourceManifest GetManifest() const;
+        void OnCleanup();
 
     private:
         void InitGeneration();
@@ -33,6 +39,7 @@ namespace FlappyBird
         void StartStats();
         void StartBirds();
         void StartBird(Bird& bird);
+        void StartBackground();
 
         void UpdateGeneration();
         void UpdateBird(Bird& bird);
@@ -46,6 +53,7 @@ namespace FlappyBird
         void EventObstacleSpawn();
         void EventGenerationNext();
         void EventGenerationNextStats();
+        void EventTimeScaleNext();
 
         void HandleCollisions();
         void HandleCollisionsBirds();
@@ -10,12 +10,14 @@ namespace LevelEditor
     {
     private:
         TileMap map;
+        ResourceHandle<sf::Texture> tilesetTexture;
         Camera camera;
         sf::RectangleShape preview;
         SelectedTile selected;
         sf::Text infos;
         bool showTileset;
         Cooldown placeCooldown;
+        ResourceHandle<sf::Texture> backgroundTexture;
         sf::RectangleShape background;
 
     public:
@@ -25,6 +27,9 @@ namespace LevelEditor
         void OnEvent(const sf::Event&);
         void Update();
         void Render() const;
+        bool IsOpaque() const;
+        ResourceManifest GetManifest() const;
+        void OnCleanup();
 
     private:
         void InitInfos();
@@ -37,6 +42,7 @@ namespace LevelEditor
         void StartMap();
         void StartInfos();
         void StartSelected();
+        void StartBackground();
 
         void HandleEvent(const sf::Event::TextEntered&);
         void HandleEvent(const sf::Event::KeyPressed&);
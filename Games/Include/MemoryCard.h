@@ -9,6 +9,7 @@ namespace MemoryCard
     class Game : public Scene
     {
     private:
+        ResourceHandle<sf::Texture> cardTexture;
         std::vector<Card> cards;
         CardPair cardPair;
         Stats stats;
@@ -20,7 +21,8 @@ namespace MemoryCard
         void OnEvent(const sf::Event&);
         void Update();
         void Render() const;
-        void OnPause(bool);
+        ResourceManifest GetManifest() const;
+        void OnCleanup();
 
     private:
         void InitCardPair();
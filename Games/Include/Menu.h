@@ -9,6 +9,7 @@ namespace Menu
     class Game : public Scene
     {
     private:
+        ResourceHandle<sf::Texture> buttonTexture;
         std::vector<Button> buttons;
         Controls controls;
         sf::Music music;
@@ -29,6 +30,7 @@ namespace Menu
         void InitControls();
         void InitMusic();
 
+        void StartButtons();
         void StartControls();
         void StartMusic();
 
@@ -9,14 +9,20 @@ namespace MineStorm
     class Game : public Scene
     {
     private:
+        ResourceHandle<sf::Texture> playerTexture;
         Player player;
-        std::vector<Enemy> enemies;
-        std::vector<Bullet> bullets;
-        std::vector<Explosion> explosions;
+        Pool<Enemy, ENEMY_CAPACITY> enemies;
+        std::vector<Mesh> enemyMeshes;
+        MeshBatch enemyBatch;
+        Pool<Bullet, BULLET_CAPACITY> bullets;
         Wave wave;
+        ResourceHandle<sf::Texture> backgroundTexture;
+        ResourceHandle<sf::Texture> foregroundTexture;
         sf::RectangleShape background;
         sf::RectangleShape foreground;
-        sf::Texture& explosionTexture;
+        ResourceHandle<sf::Texture> explosionTexture;
+        std::optional<AnimationClip> explosionAnimation;
+        std::optional<AnimationBatch> explosions;
 
     public:
         Game(EngineContext&);
@@ -24,15 +30,20 @@ namespace MineStorm
         void Start();
         void Update();
         void Render() const;
-        void OnPause(bool);
+        bool IsOpaque() const;
+        ResourceManifest GetManifest() const;
+        void OnCleanup();
 
     private:
         void InitPlayer();
+        void InitEnemyMeshes();
         void InitBackground();
 
         void BindInputs();
 
         void StartPlayer();
+        void StartBackground();
+        void StartExplosions();
 
         void UpdatePlayer();
         void UpdatePlayerRotation();
@@ -42,6 +53,7 @@ namespace MineStorm
         void UpdateEnemy(Enemy& enemy);
         void UpdateBullets();
         void UpdateExplosions();
+        void UpdateEnemyBatch();
 
         void EventPlayerShoot();
         void EventPlayerShipReset();
@@ -50,18 +62,20 @@ namespace MineStorm
         void EventEnemyShoot(const Enemy& enemy);
         void EventEnemyDead(const Enemy& enemy);
         void EventExplosion(const sf::Shape& shape);
+        void EventExplosion(const Enemy& enemy);
 
         void HandleCollisions();
         void HandleCollisionsPlayerMap();
         void HandleCollisionsPlayerEnemies();
         void ResolveCollisionPlayerEnemy();
         void HandleCollisionsEnemiesMap();
-        void HandleCollisionsShapeMap(sf::Shape& shape);
+        void HandleCollisionsShapeMap(sf::Transformable& shape, sf::Vector2f size);
         void HandleCollisionsBullets();
         void ResolveCollisionBulletPlayer(Bullet& bullet);
         void HandleCollisionsBulletEnemies(Bullet& bullet);
         void ResolveCollisionBulletEnemy(Bullet& bullet, Enemy& enemy);
 
         sf::CircleShape GenerateSpawnPoint() const;
+        sf::FloatRect GetEnemyBounds(const Enemy& enemy) const;
     };
 }
\ No newline at end of file
@@ -47,7 +47,7 @@ namespace Puzzle
         void EventCellsActionMoveLeftApply(std::array<std::array<bool, GRID_SIZE>, GRID_SIZE>& merged, int i, int j);
         void EventCellsMerge(Cell& from, Cell& to);
 
-        std::vector<sf::Vector2i> GetEmptyCells() const;
+        std::pmr::vector<sf::Vector2i> GetEmptyCells() const;
         int GetCellLeftDestination(int i, int j) const;
         sf::Color GetCellColor(const Cell& cell) const;
         sf::Color GetTextColor(const Cell& cell) const;
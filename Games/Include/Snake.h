@@ -12,8 +12,8 @@ namespace Snake
         Player player;
         Bonus bonus;
         Map map;
-        sf::Texture& tilesetTexture;
-        sf::Sound bonusSound;
+        ResourceHandle<sf::Texture> tilesetTexture;
+        ResourceHandle<sf::SoundBuffer> bonusSound;
 
     public:
         Game(EngineContext&);
@@ -21,6 +21,7 @@ namespace Snake
         void Start();
         void Update();
         void Render() const;
+        ResourceManifest GetManifest() const;
         void OnPause(bool);
         void OnCleanup();
 
@@ -58,6 +59,7 @@ namespace Snake
         void ResolveCollisionPlayerBonus();
 
         sf::Vector2f GetPlayerHeadNextPosition() const;
-        std::string GetCornerTextureKey() const;
+        PartTexture GetCornerTexture() const;
+        const sf::IntRect& GetTextureRect(PartTexture texture) const;
     };
 }
\ No newline at end of file
@@ -9,10 +9,11 @@ namespace SpaceInvaders
     class Game : public Scene
     {
     private:
+        ResourceHandle<sf::Texture> playerTexture;
         Player player;
         Wave wave;
         std::vector<Bunker> bunkers;
-        std::vector<Bullet> bullets;
+        Pool<Bullet, BULLET_CAPACITY> bullets;
 
     public:
         Game(EngineContext&);
@@ -20,6 +21,8 @@ namespace SpaceInvaders
         void Start();
         void Update();
         void Render() const;
+        ResourceManifest GetManifest() const;
+        void OnCleanup();
 
     private:
         void InitPlayer();
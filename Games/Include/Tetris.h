@@ -24,7 +24,6 @@ namespace Tetris
         void OnEvent(const sf::Event&);
         void Update();
         void Render() const;
-        void OnPause(bool);
 
     private:
         void InitStats();
@@ -38,7 +38,7 @@ namespace TicTacToe
 
         sf::Vector2i GetCellPositionCursor() const;
         sf::Vector2i GetCellPositionAI();
-        std::vector<sf::Vector2i> FindCellPositionsEmpty() const;
+        std::pmr::vector<sf::Vector2i> FindCellPositionsEmpty() const;
         std::optional<sf::Vector2i> FindCellPositionWinning(std::span<sf::Vector2i> candidates, char symbol);
         bool IsCellPositionValid(sf::Vector2i position) const;
         bool IsWin(char symbol) const;
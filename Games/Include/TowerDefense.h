@@ -11,8 +11,10 @@ namespace TowerDefense
     private:
         Stats stats;
         std::vector<Tower> towers;
-        std::vector<Enemy> enemies;
-        std::vector<Bullet> bullets;
+        Pool<Enemy, ENEMY_CAPACITY> enemies;
+        Pool<Bullet, BULLET_CAPACITY> bullets;
+        ResourceHandle<sf::Texture> castleTexture;
+        ResourceHandle<sf::Texture> enemyTexture;
         Castle castle;
         Wave wave;
         Map map;
@@ -29,7 +31,7 @@ namespace TowerDefense
         void OnEvent(const sf::Event&);
         void Update();
         void Render() const;
-        void OnPause(bool);
+        ResourceManifest GetManifest() const;
         void OnCleanup();
 
     private:
@@ -55,7 +57,7 @@ namespace TowerDefense
         void UpdateTowers();
         void UpdateBullets();
         void UpdateCastle();
-        void UpdateHealth(Health& health, const sf::Shape& shape);
+        void UpdateHealth(Health& health, const PhysicsBody& body);
         void UpdateUI();
 
         void EventTowerPlacement();
@@ -65,6 +67,7 @@ namespace TowerDefense
         void EventBulletSpawn(Tower& tower, const Enemy& target);
         void EventWaveNew();
         void EventEnemySpawn();
+        void EventTimeScaleNext();
 
         void HandleCollisions();
         void HandleCollisionsBullets();
@@ -22,6 +22,7 @@ namespace Breakout
     struct Player
     {
         sf::RectangleShape shape;
+        PhysicsBody body;
         bool magnetic;
         Stats stats;
     };
@@ -29,6 +30,7 @@ namespace Breakout
     struct Ball
     {
         sf::CircleShape shape;
+        PhysicsBody body;
         sf::Vector2f direction;
         float speed;
         bool alive;
@@ -39,6 +41,7 @@ namespace Breakout
     struct Brick
     {
         sf::RectangleShape shape;
+        PhysicsBody body;
         int lives;
     };
 
@@ -24,6 +24,7 @@ namespace Clicker
         float bestTime;
         sf::Text scoreText{GetDefaultFont()};
         sf::Text finalCooldownText{GetDefaultFont()};
+        std::string finalCooldownString;
         sf::Text bestTimeText{GetDefaultFont()};
     };
 }
\ No newline at end of file
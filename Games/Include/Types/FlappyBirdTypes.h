@@ -22,9 +22,11 @@ namespace FlappyBird
         int index;
         int birdCount;
         int score;
+        std::size_t timeScale;
         sf::Text indexText{GetDefaultFont()};
         sf::Text birdCountText{GetDefaultFont()};
         sf::Text scoreText{GetDefaultFont()};
+        sf::Text timeScaleText{GetDefaultFont()};
     };
 
     struct Obstacle
@@ -6,7 +6,8 @@
 
 #include <queue>
 
-#include "Graphics/AnimatedShape.h"
+#include "Graphics/AnimationBatch.h"
+#include "Graphics/MeshBatch.h"
 
 namespace MineStorm
 {
@@ -43,7 +44,8 @@ namespace MineStorm
 
     struct Enemy
     {
-        sf::ConvexShape shape;
+        sf::Transformable transform;
+        sf::Color color;
         sf::Vector2f direction;
         EnemyType type;
         float speed;
@@ -76,9 +78,4 @@ namespace MineStorm
         bool alive;
         BulletType type;
     };
-
-    struct Explosion
-    {
-        AnimatedShape shape;
-    };
 }
\ No newline at end of file
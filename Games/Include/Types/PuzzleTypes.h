@@ -31,6 +31,5 @@ namespace Puzzle
     struct Stats
     {
         float animationProgress;
-        bool previousPressed;
     };
 }
\ No newline at end of file
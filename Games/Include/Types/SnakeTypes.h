@@ -22,6 +22,17 @@ namespace Snake
         Up, Down, Left, Right, None
     };
 
+    // Corners are named after the turn they draw, which also matches the reverse turn
+    enum class PartTexture
+    {
+        HeadUp, HeadDown, HeadLeft, HeadRight,
+        BodyVertical, BodyHorizontal,
+        CornerUpRight, CornerDownRight, CornerUpLeft, CornerDownLeft,
+        TailUp, TailDown, TailLeft, TailRight,
+        Apple,
+        Count
+    };
+
     struct Part
     {
         sf::RectangleShape shape;
@@ -49,7 +60,7 @@ namespace Snake
         std::vector<Corner> corners;
         Direction nextDirection;
         Stats stats;
-        std::unordered_map<std::string, sf::IntRect> texturesRect;
+        std::array<sf::IntRect, std::size_t(PartTexture::Count)> texturesRect;
         Cooldown moveCooldown;
     };
 
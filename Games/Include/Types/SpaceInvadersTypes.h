@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Config/SpaceInvadersConfig.h"
+#include "Managers/ResourceManager.h"
 
 namespace SpaceInvaders
 {
@@ -41,7 +42,7 @@ namespace SpaceInvaders
         sf::Vector2f direction;
         Cooldown moveCooldown;
         Cooldown shootCooldown;
-        std::array<sf::Texture*, 3> textures;
+        std::array<ResourceHandle<sf::Texture>, 3> textures;
     };
 
     struct BunkerPart
@@ -15,6 +15,8 @@ namespace TowerDefense
         tgui::ProgressBar::Ptr waveBar;
         tgui::Label::Ptr waveLabel;
         tgui::Label::Ptr statsLabel;
+        std::string waveString;
+        std::string statsString;
     };
 
     struct Health
@@ -37,11 +39,13 @@ namespace TowerDefense
     {
         int money;
         int level;
+        std::size_t timeScale;
     };
 
     struct Enemy
     {
         sf::RectangleShape shape;
+        PhysicsBody body;
         Health health;
         sf::Vector2f direction;
         float speed;
@@ -58,6 +62,7 @@ namespace TowerDefense
     struct Bullet
     {
         sf::CircleShape shape;
+        PhysicsBody body;
         sf::Vector2f direction;
         float speed;
         int damage;
@@ -82,6 +87,7 @@ namespace TowerDefense
     struct Castle
     {
         sf::RectangleShape shape;
+        PhysicsBody body;
         Health health;
     };
 }
\ No newline at end of file
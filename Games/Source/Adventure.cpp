@@ -6,13 +6,13 @@ using namespace Adventure;
 
 Game::Game(EngineContext& context) :
     Scene(context),
-    enemySpawnCooldown(ENEMY_SPAWN_COOLDOWN_DURATION),
-    bonusSound(*ctx.resources.FetchSound(BONUS_SOUND_FILENAME))
+    enemySpawnCooldown(ENEMY_SPAWN_COOLDOWN_DURATION)
 {
     InitPlayer();
     InitCamera();
-    InitSounds();
     InitBackground();
+
+    PrewarmGlyphs(DEFAULT_CHARACTER_SIZE, PRINTABLE_CHARACTERS, 2);
 }
 
 void Game::InitPlayer()
@@ -30,14 +30,8 @@ void Game::InitCamera()
     camera.smoothFactor = CAMERA_SMOOTH_FACTOR;
 }
 
-void Game::InitSounds()
-{
-    bonusSound.setVolume(BONUS_SOUND_VOLUME);
-}
-
 void Game::InitBackground()
 {
-    background.setTexture(ctx.resources.FetchTexture(BACKGROUND_TEXTURE_FILENAME));
     background.setFillColor(BACKGROUND_COLOR);
     background.setSize(gConfig.windowSize);
 }
@@ -48,12 +42,15 @@ void Game::Start()
 
     BindInputs();
 
-    enemies.clear();
-    bullets.clear();
+    enemies.Clear();
+    bullets.Clear();
+    enemyTexture = ctx.resources.FetchTextureAsync(ENEMY_TEXTURE);
+    bonusSound = ctx.resources.FetchSound(BONUS_SOUND);
 
     StartMap();
     StartPlayer();
     StartCamera();
+    StartBackground();
 
     enemySpawnCooldown.Restart();
 }
@@ -84,13 +81,16 @@ void Game::BindInputs()
 
 void Game::StartMap()
 {
-    VERIFY(map.LoadFromFile(TILEMAP_LEVEL_FILENAME, TILEMAP_TEXTURE_FILENAME));
+    tilesetTexture = ctx.resources.FetchTexture(TILEMAP_TEXTURE);
+    VERIFY(map.LoadFromFile(TILEMAP_LEVEL_FILENAME, *tilesetTexture));
 }
 
 void Game::StartPlayer()
 {
-    player.shape.Start({ctx.resources.FetchTexture(PLAYER_TEXTURE_FILENAME),
-                        PLAYER_ANIMATION_FRAMES_PER_ROW, PLAYER_ANIMATION_FRAME_DURATION});
+    // Rebuilt on every start, the texture may have been evicted and reloaded elsewhere since
+    playerTexture = ctx.resources.FetchTexture(PLAYER_TEXTURE);
+    playerAnimation.emplace(*playerTexture, PLAYER_ANIMATION_FRAMES_PER_ROW, PLAYER_ANIMATION_FRAME_DURATION);
+    player.shape.Start(*playerAnimation);
 
     player.shape.setSize(sf::Vector2f(map.GetTileSize()));
     player.shape.setOrigin(player.shape.getGeometricCenter());
@@ -127,6 +127,12 @@ void Game::StartCamera()
     camera.view.setCenter(player.shape.getPosition());
 }
 
+void Game::StartBackground()
+{
+    backgroundTexture = ctx.resources.FetchTexture(BACKGROUND_TEXTURE);
+    background.setTexture(backgroundTexture.Get());
+}
+
 void Game::Update()
 {
     if (ctx.input.Pressed(Shoot) && player.shootCooldown.IsOver())
@@ -296,7 +302,14 @@ void Game::EventPlayerShoot()
         return;
     }
 
-    auto& bullet = bullets.emplace_back();
+    Bullet* spawned = bullets.Spawn();
+
+    if (!spawned)
+    {
+        return;
+    }
+
+    auto& bullet = *spawned;
 
     bullet.shape.setFillColor(BULLET_COLOR);
     bullet.shape.setRadius(BULLET_RADIUS);
@@ -333,23 +346,32 @@ void Game::EventPlayerBonus()
 {
     player.score++;
     player.scoreText.setString("Score: " + std::to_string(player.score));
-    bonusSound.play();
+    ctx.audio.Play(bonusSound, BONUS_SOUND_PRIORITY, std::nullopt, BONUS_SOUND_VOLUME);
 }
 
 void Game::EventEnemySpawn()
 {
-    auto& enemy = enemies.emplace_back();
+    Enemy* spawned = enemies.Spawn();
+
+    if (!spawned)
+    {
+        return;
+    }
+
+    auto& enemy = *spawned;
 
-    enemy.shape.setTexture(ctx.resources.FetchTexture(ENEMY_TEXTURE_FILENAME));
+    enemy.shape.setTexture(enemyTexture.Get());
     enemy.shape.setFillColor(ENEMY_COLOR);
     enemy.shape.setSize(player.shape.getSize() / 2.f);
     enemy.shape.setOrigin(enemy.shape.getGeometricCenter());
     sf::Vector2f offset(ENEMY_SPAWN_RADIUS, ctx.random.Angle(sf::Angle::Zero, sf::degrees(360)));
     enemy.shape.setPosition(player.shape.getPosition() + offset);
 
+    enemy.velocity = {};
     enemy.lives = ENEMY_LIVES;
 
     enemy.knockbackCooldown.SetDuration(ENEMY_KNOCKBACK_COOLDOWN_DURATION);
+    enemy.knockbackCooldown.Restart();
 }
 
 void Game::EventEnemyKnockback(Enemy& enemy, sf::Vector2f velocity, int damage)
@@ -460,7 +482,7 @@ void Game::HandleCollisionsPlayerEnemies()
         }
     }
 
-    std::erase_if(enemies, [](const Enemy& enemy) { return enemy.lives <= 0; });
+    enemies.RemoveIf([](const Enemy& enemy) { return enemy.lives <= 0; });
 }
 
 void Game::ResolveCollisionPlayerEnemy(Enemy& enemy)
@@ -479,7 +501,7 @@ void Game::HandleCollisionsBullets()
         HandleCollisionsBulletEnemies(bullet);
     }
 
-    std::erase_if(bullets, [](const Bullet& bullet) {
+    bullets.RemoveIf([](const Bullet& bullet) {
         return !bullet.alive || IsOutsideWindow(bullet.shape.getPosition());
     });
 }
@@ -511,7 +533,7 @@ void Game::HandleCollisionsBulletEnemies(Bullet& bullet)
         }
     }
 
-    std::erase_if(enemies, [](const Enemy& enemy) { return enemy.lives <= 0; });
+    enemies.RemoveIf([](const Enemy& enemy) { return enemy.lives <= 0; });
 }
 
 void Game::ResolveCollisionBulletEnemy(Bullet& bullet, Enemy& enemy)
@@ -522,9 +544,9 @@ void Game::ResolveCollisionBulletEnemy(Bullet& bullet, Enemy& enemy)
 
 void Game::HandleCollisionsEnemies()
 {
-    for (std::size_t i = 0; i < enemies.size(); i++)
+    for (std::size_t i = 0; i < enemies.GetSize(); i++)
     {
-        for (std::size_t j = i + 1; j < enemies.size(); j++)
+        for (std::size_t j = i + 1; j < enemies.GetSize(); j++)
         {
             if (Intersects(enemies[i].shape, enemies[j].shape))
             {
@@ -624,20 +646,23 @@ void Game::Render() const
     ctx.renderer.Draw(player.livesText);
 }
 
-void Game::OnPause(bool paused)
+bool Game::IsOpaque() const
 {
-    if (paused)
-    {
-        enemySpawnCooldown.Stop();
-        player.jumpCooldown.Stop();
-        player.shootCooldown.Stop();
-        player.forceFieldCooldown.Stop();
-    }
-    else
-    {
-        enemySpawnCooldown.Start();
-        player.jumpCooldown.Start();
-        player.shootCooldown.Start();
-        player.forceFieldCooldown.Start();
-    }
+    return true;
+}
+
+ResourceManifest Game::GetManifest() const
+{
+    return {.textures = {PLAYER_TEXTURE, ENEMY_TEXTURE, TILEMAP_TEXTURE, BACKGROUND_TEXTURE}, .sounds = {BONUS_SOUND}};
+}
+
+void Game::OnCleanup()
+{
+    playerAnimation.reset();
+
+    tilesetTexture = {};
+    playerTexture = {};
+    enemyTexture = {};
+    backgroundTexture = {};
+    bonusSound = {};
 }
\ No newline at end of file
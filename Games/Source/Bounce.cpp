@@ -7,13 +7,11 @@ using namespace Bounce;
 Game::Game(EngineContext& context) :
     Scene(context),
     ballSpawnCooldown(BALL_SPAWN_COOLDOWN_DURATION),
-    bounceSound(*ctx.resources.FetchSound(BOUNCE_SOUND_FILENAME)),
-    music(*ctx.resources.FetchMusic(MUSIC_FILENAME))
+    music(*ctx.resources.FetchMusic(MUSIC))
 {
     InitPaddle();
     InitStats();
     InitBackground();
-    InitBounceSound();
     InitMusic();
 }
 
@@ -40,15 +38,9 @@ void Game::InitStats()
 
 void Game::InitBackground()
 {
-    background.setTexture(ctx.resources.FetchTexture(BACKGROUND_TEXTURE_FILENAME));
     background.setSize(gConfig.windowSize);
 }
 
-void Game::InitBounceSound()
-{
-    bounceSound.setVolume(BOUNCE_SOUND_VOLUME);
-}
-
 void Game::InitMusic()
 {
     music.setVolume(MUSIC_VOLUME);
@@ -63,9 +55,11 @@ void Game::Start()
     BindInputs();
 
     balls.clear();
+    bounceSound = ctx.resources.FetchSound(BOUNCE_SOUND);
 
     StartPaddle();
     StartStats();
+    StartBackground();
     StartMusic();
 
     ballSpawnCooldown.Restart();
@@ -97,6 +91,12 @@ void Game::StartStats()
     stats.livesText.setString("Lives: " + std::to_string(stats.lives));
 }
 
+void Game::StartBackground()
+{
+    backgroundTexture = ctx.resources.FetchTexture(BACKGROUND_TEXTURE);
+    background.setTexture(backgroundTexture.Get());
+}
+
 void Game::StartMusic()
 {
     music.play();
@@ -209,7 +209,7 @@ void Game::HandleCollisionsPaddleBalls()
 void Game::ResolveCollisionPaddleBall(Ball& ball)
 {
     ball.direction.y *= -1;
-    bounceSound.play();
+    ctx.audio.Play(bounceSound, BOUNCE_SOUND_PRIORITY, std::nullopt, BOUNCE_SOUND_VOLUME);
 
     stats.score++;
     stats.scoreText.setString("Score: " + std::to_string(stats.score));
@@ -243,17 +243,25 @@ void Game::Render() const
     ctx.renderer.Draw(stats.livesText);
 }
 
+bool Game::IsOpaque() const
+{
+    return true;
+}
+
+ResourceManifest Game::GetManifest() const
+{
+    return {.textures = {BACKGROUND_TEXTURE}, .sounds = {BOUNCE_SOUND}};
+}
+
 void Game::OnPause(bool paused)
 {
     if (paused)
     {
-        ballSpawnCooldown.Stop();
         music.pause();
-        bounceSound.stop();
+        ctx.audio.StopSounds();
     }
     else
     {
-        ballSpawnCooldown.Start();
         music.play();
     }
 }
@@ -261,5 +269,8 @@ void Game::OnPause(bool paused)
 void Game::OnCleanup()
 {
     music.stop();
-    bounceSound.stop();
+    ctx.audio.StopSounds();
+
+    backgroundTexture = {};
+    bounceSound = {};
 }
\ No newline at end of file
@@ -10,11 +10,12 @@ Game::Game(EngineContext& context) :
     Scene(context)
 {
     InitPlayer();
+
+    PrewarmGlyphs(BONUS_TEXT_SIZE);
 }
 
 void Game::InitPlayer()
 {
-    player.shape.setTexture(ctx.resources.FetchTexture(PLAYER_TEXTURE_FILENAME));
     player.shape.setFillColor(PLAYER_COLOR);
     player.shape.setSize(gConfig.windowSize.componentWiseMul({0.12f, 0.03f}));
     player.shape.setOrigin(player.shape.getGeometricCenter());
@@ -24,7 +25,7 @@ void Game::Start()
 {
     ctx.cursor.SetVisible(false);
 
-    balls.clear();
+    balls.Clear();
     bonuses.clear();
 
     StartPlayer();
@@ -35,6 +36,9 @@ void Game::Start()
 
 void Game::StartPlayer()
 {
+    playerTexture = ctx.resources.FetchTexture(PLAYER_TEXTURE);
+    player.shape.setTexture(playerTexture.Get());
+
     player.shape.setPosition(gConfig.windowSize.componentWiseMul({0.50f, 0.90f}));
     player.shape.setScale({1, 1});
 
@@ -75,6 +79,8 @@ void Game::StartBrick(Brick& brick, sf::Vector2i tile)
     brick.shape.setSize({gConfig.windowSize.x / BRICK_MAP_SIZE.x,
                          gConfig.windowSize.y / (BRICK_MAP_SIZE.y * 4.5f)});
     brick.shape.setPosition(sf::Vector2f(tile).componentWiseMul(brick.shape.getSize()));
+
+    brick.body.Fit(brick.shape);
 }
 
 void Game::Update()
@@ -90,16 +96,18 @@ void Game::UpdatePlayer()
 {
     float positionY = player.shape.getPosition().y;
     player.shape.setPosition({ctx.cursor.GetPosition().x, positionY});
+    player.body.Fit(player.shape);
 
-    sf::FloatRect bounds = player.shape.getGlobalBounds();
-    if (IsOutsideWindowLeft(player.shape))
+    if (IsOutsideWindowLeft(player.body))
     {
-        player.shape.setPosition({bounds.size.x / 2, positionY});
+        player.shape.setPosition({player.body.GetHalfSize().x, positionY});
     }
-    else if (IsOutsideWindowRight(player.shape))
+    else if (IsOutsideWindowRight(player.body))
     {
-        player.shape.setPosition({gConfig.windowSize.x - bounds.size.x / 2, positionY});
+        player.shape.setPosition({gConfig.windowSize.x - player.body.GetHalfSize().x, positionY});
     }
+
+    player.body.SetPosition(player.shape.getPosition());
 }
 
 void Game::UpdateBalls()
@@ -119,6 +127,7 @@ void Game::UpdateBall(Ball& ball)
     }
 
     ball.shape.move(ball.direction * ball.speed * ctx.time.GetDeltaTime());
+    ball.body.SetPosition(ball.shape.getPosition());
 }
 
 void Game::UpdateBonuses()
@@ -152,7 +161,14 @@ void Game::UpdateBonusesCleanup()
 
 void Game::EventBallSpawn()
 {
-    auto& ball = balls.emplace_back();
+    Ball* spawned = balls.Spawn();
+
+    if (!spawned)
+    {
+        return;
+    }
+
+    auto& ball = *spawned;
 
     ball.shape.setFillColor(BALL_COLOR);
     ball.shape.setRadius(BALL_RADIUS);
@@ -171,6 +187,7 @@ void Game::EventBallReset(Ball& ball)
 
     sf::Vector2f offset(0, player.shape.getGlobalBounds().size.y);
     ball.shape.setPosition(player.shape.getPosition() - offset);
+    ball.body.Fit(ball.shape);
 
     ball.fire = false;
     ball.invincible = false;
@@ -178,7 +195,7 @@ void Game::EventBallReset(Ball& ball)
 
 void Game::EventBonusEnable()
 {
-    std::vector<BonusType> types = GetBonusTypesAllowed();
+    std::pmr::vector<BonusType> types = GetBonusTypesAllowed();
 
     if (types.empty())
     {
@@ -202,6 +219,8 @@ void Game::EventBonusEnable()
         default: break;
     }
 
+    player.body.Fit(player.shape);
+
     bonus.text.setCharacterSize(BONUS_TEXT_SIZE);
     bonus.text.setString(std::string(magic_enum::enum_name(bonus.type)));
     bonus.text.setPosition({gConfig.windowSize.x * 0.75f, 
@@ -224,6 +243,8 @@ void Game::EventBonusDisable(const Bonus& bonus)
         case InvincibleBall: for (Ball& ball : balls) { ball.invincible = false; } break;
         default: break;
     }
+
+    player.body.Fit(player.shape);
 }
 
 void Game::HandleCollisions()
@@ -259,23 +280,23 @@ void Game::HandleCollisionsBallsMap()
         HandleCollisionsBallMap(ball);
     }
 
-    std::erase_if(balls, [](const Ball& ball) { return !ball.alive; });
+    balls.RemoveIf([](const Ball& ball) { return !ball.alive; });
 }
 
 void Game::HandleCollisionsBallMap(Ball& ball)
 {
-    if (ball.direction.y > 0 && Intersects(ball.shape, player.shape))
+    if (ball.direction.y > 0 && Intersects(ball.body, player.body))
     {
         ResolveCollisionBallPlayer(ball);
     }
 
-    if ((ball.direction.x < 0 && IsOutsideWindowLeft(ball.shape)) ||
-        (ball.direction.x > 0 && IsOutsideWindowRight(ball.shape)))
+    if ((ball.direction.x < 0 && IsOutsideWindowLeft(ball.body)) ||
+        (ball.direction.x > 0 && IsOutsideWindowRight(ball.body)))
     {
         ball.direction.x *= -1;
     }
 
-    if (ball.direction.y < 0 && IsOutsideWindowTop(ball.shape))
+    if (ball.direction.y < 0 && IsOutsideWindowTop(ball.body))
     {
         ball.direction.y *= -1;
     }
@@ -289,7 +310,7 @@ void Game::HandleCollisionsBallMap(Ball& ball)
 void Game::ResolveCollisionBallPlayer(Ball& ball)
 {
     float ballRelativePositionX = ball.shape.getPosition().x - player.shape.getPosition().x;
-    float impactFactorX = ballRelativePositionX / (player.shape.getGlobalBounds().size.x / 2);
+    float impactFactorX = ballRelativePositionX / player.body.GetHalfSize().x;
     float ballHitPositionX = std::clamp(impactFactorX, -1.f, 1.f);
 
     float angle = BALL_ANGLE_MAX.asRadians() * ballHitPositionX;
@@ -312,7 +333,7 @@ void Game::ResolveCollisionBallDown(Ball& ball)
         LOG_INFO("You Lose!");
         ctx.scenes.RestartCurrentScene();
     }
-    else if (balls.size() == 1)
+    else if (balls.GetSize() == 1)
     {
         EventBallReset(ball);
     }
@@ -326,7 +347,7 @@ void Game::HandleCollisionsBallBricks(Ball& ball)
 {
     for (auto& brick : bricks)
     {
-        if (Intersects(ball.shape, brick.shape))
+        if (Intersects(ball.body, brick.body))
         {
             ResolveCollisionBallBrick(ball, brick);
             break;
@@ -362,26 +383,28 @@ void Game::ResolveCollisionBallBrick(Ball& ball, Brick& brick)
 
 void Game::ResolveCollisionBallBrickBounce(Ball& ball, Brick& brick)
 {
-    if (auto intersection = Intersects(ball.shape, brick.shape))
+    if (auto intersection = Intersects(ball.body, brick.body))
     {
         if (intersection->size.x < intersection->size.y)
         {
             ball.direction.x *= -1;
             float correction = intersection->size.x / 2 + 1;
             ball.shape.move({(ball.direction.x > 0) ? correction : -correction, 0});
+            ball.body.SetPosition(ball.shape.getPosition());
         }
         else
         {
             ball.direction.y *= -1;
             float correction = intersection->size.y / 2 + 1;
             ball.shape.move({0, (ball.direction.y > 0) ? correction : -correction});
+            ball.body.SetPosition(ball.shape.getPosition());
         }
     }
 }
 
-std::vector<BonusType> Game::GetBonusTypesAllowed() const
+std::pmr::vector<BonusType> Game::GetBonusTypesAllowed() const
 {
-    std::vector<BonusType> types;
+    std::pmr::vector<BonusType> types(&ctx.arena);
 
     for (int i = 0; i < BonusType::Count; i++)
     {
@@ -450,20 +473,12 @@ void Game::Render() const
     ctx.renderer.Draw(player.stats.livesText);
 }
 
-void Game::OnPause(bool paused)
+ResourceManifest Game::GetManifest() const
 {
-    if (paused)
-    {
-        for (auto& bonus : bonuses)
-        {
-            bonus.endCooldown.Stop();
-        }
-    }
-    else
-    {
-        for (auto& bonus : bonuses)
-        {
-            bonus.endCooldown.Start();
-        }
-    }
+    return {.textures = {PLAYER_TEXTURE}};
+}
+
+void Game::OnCleanup()
+{
+    playerTexture = {};
 }
\ No newline at end of file
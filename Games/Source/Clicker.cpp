@@ -9,11 +9,12 @@ Game::Game(EngineContext& context) :
 {
     InitTarget();
     InitStats();
+
+    PrewarmGlyphs(STATS_TEXT_SIZE);
 }
 
 void Game::InitTarget()
 {
-    target.shape.setTexture(ctx.resources.FetchTexture(TARGET_TEXTURE_FILENAME));
     target.shape.setRadius(TARGET_RADIUS);
     target.shape.setOrigin(target.shape.getGeometricCenter());
 
@@ -55,6 +56,9 @@ void Game::BindInputs()
 
 void Game::StartTarget()
 {
+    targetTexture = ctx.resources.FetchTexture(TARGET_TEXTURE);
+    target.shape.setTexture(targetTexture.Get());
+
     target.shape.setFillColor(TARGET_COLOR);
     target.shape.setPosition(gConfig.windowSize / 2.f);
 }
@@ -67,7 +71,8 @@ void Game::StartStats()
     stats.finalCooldown.Reset();
 
     float totalTime = stats.finalCooldown.GetDuration();
-    stats.finalCooldownText.setString("Time Left (s): " + std::to_string((int)totalTime));
+    stats.finalCooldownString = "Time Left (s): " + std::to_string((int)totalTime);
+    stats.finalCooldownText.setString(stats.finalCooldownString);
 
     stats.bestTime = ctx.save.Get<float>(STATS_BEST_TIME_KEY, totalTime);
     stats.bestTimeText.setString(std::format("Best Time: {:.2f}", stats.bestTime));
@@ -75,9 +80,13 @@ void Game::StartStats()
 
 void Game::Update()
 {
-    if (ctx.input.Pressed(Click) && IsTargetHovered())
+    // Every press counts, even one released before the frame ended
+    for (const auto& event : ctx.input.GetEvents())
     {
-        EventTargetClicked();
+        if (event.action == Click && event.pressed && IsTargetHovered())
+        {
+            EventTargetClicked();
+        }
     }
 
     if (stats.finalCooldown.IsRunning())
@@ -111,7 +120,14 @@ void Game::UpdateTargetColor()
 void Game::UpdateStats()
 {
     float timeLeft = stats.finalCooldown.GetDuration() - stats.finalCooldown.GetElapsedTime();
-    stats.finalCooldownText.setString(std::format("Time Left (s): {:.1f}", timeLeft));
+    const auto finalCooldownString = ctx.arena.Format("Time Left (s): {:.1f}", timeLeft);
+
+    // setString copies into the heap, so it only runs when the shown tenth of a second changes
+    if (std::string_view(finalCooldownString) != stats.finalCooldownString)
+    {
+        stats.finalCooldownString = finalCooldownString;
+        stats.finalCooldownText.setString(stats.finalCooldownString);
+    }
 
     if (stats.finalCooldown.IsOver())
     {
@@ -168,16 +184,12 @@ void Game::Render() const
     ctx.renderer.Draw(stats.bestTimeText);
 }
 
-void Game::OnPause(bool paused)
+ResourceManifest Game::GetManifest() const
 {
-    if (paused)
-    {
-        target.teleportCooldown.Stop();
-        stats.finalCooldown.Stop();
-    }
-    else
-    {
-        target.teleportCooldown.Start();
-        stats.finalCooldown.Start();
-    }
+    return {.textures = {TARGET_TEXTURE}};
+}
+
+void Game::OnCleanup()
+{
+    targetTexture = {};
 }
\ No newline at end of file
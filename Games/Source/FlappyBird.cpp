@@ -11,6 +11,8 @@ Game::Game(EngineContext& context) :
 {
     InitGeneration();
     InitBackground();
+
+    PrewarmGlyphs(DEFAULT_CHARACTER_SIZE, PRINTABLE_CHARACTERS, 2);
 }
 
 void Game::InitGeneration()
@@ -21,7 +23,6 @@ void Game::InitGeneration()
 
 void Game::InitBackground()
 {
-    background.setTexture(ctx.resources.FetchTexture(BACKGROUND_TEXTURE_FILENAME));
     background.setFillColor(BACKGROUND_COLOR);
     background.setSize(gConfig.windowSize);
 }
@@ -36,8 +37,7 @@ void Game::InitBirds()
 
 void Game::InitBird(Bird& bird)
 {
-    bird.shape.setTexture(ctx.resources.FetchTexture(BIRD_TEXTURE_FILENAME));
-    bird.shape.setFillColor(ctx.random.Color(sf::Color::Black, sf::Color::White));
+    bird.shape.setFillColor(ctx.random.Stream(RandomStream::Cosmetic).Color(sf::Color::Black, sf::Color::White));
     bird.shape.setSize(gConfig.windowSize.componentWiseMul({0.05f, 0.05f}));
     bird.shape.setOrigin(bird.shape.getGeometricCenter());
     bird.shape.setPosition(gConfig.windowSize / 2.f);
@@ -61,17 +61,25 @@ void Game::InitStats()
     generation.scoreText.setString("Score: 0");
     sf::Vector2f offsetScore(0, generation.birdCountText.getGlobalBounds().size.y * 2);
     generation.scoreText.setPosition(generation.birdCountText.getPosition() + offsetScore);
+
+    generation.timeScaleText.setFillColor(STATS_TEXT_COLOR);
+    generation.timeScaleText.setOutlineThickness(2);
+    generation.timeScaleText.setString("Speed: x1");
+    sf::Vector2f offsetTimeScale(0, generation.scoreText.getGlobalBounds().size.y * 2);
+    generation.timeScaleText.setPosition(generation.scoreText.getPosition() + offsetTimeScale);
 }
 
 void Game::Start()
 {
     obstacles.clear();
+    pipeTexture = ctx.resources.FetchTexture(PIPE_TEXTURE);
 
     StartGeneration();
+    StartBackground();
 
     EventObstacleSpawn();
 
-    clock.restart();
+    generationTimer.Restart();
 }
 
 void Game::StartGeneration()
@@ -82,6 +90,8 @@ void Game::StartGeneration()
 
 void Game::StartBirds()
 {
+    birdTexture = ctx.resources.FetchTexture(BIRD_TEXTURE);
+
     for (auto& bird : generation.birds)
     {
         StartBird(bird);
@@ -90,8 +100,9 @@ void Game::StartBirds()
 
 void Game::StartBird(Bird& bird)
 {
+    bird.shape.setTexture(birdTexture.Get());
     EventRestartBird(bird);
-    std::ranges::generate(bird.weights, [&] { return ctx.random.Float(-1, 1); });
+    ctx.random.Stream(RandomStream::AI).Fill(bird.weights, -1, 1);
 }
 
 void Game::StartStats()
@@ -104,6 +115,35 @@ void Game::StartStats()
 
     generation.score = 0;
     generation.scoreText.setString("Score: 0");
+
+    generation.timeScale = 0;
+    generation.timeScaleText.setString(std::format("Speed: x{}", TIME_SCALES[generation.timeScale]));
+    ctx.time.SetTimeScale(TIME_SCALES[generation.timeScale]);
+}
+
+void Game::OnEvent(const sf::Event& event)
+{
+    if (auto key = event.getIf<sf::Event::KeyPressed>())
+    {
+        if (key->scancode == sf::Keyboard::Scan::F)
+        {
+            EventTimeScaleNext();
+        }
+    }
+
+    if (auto joystick = event.getIf<sf::Event::JoystickButtonPressed>())
+    {
+        if (Input::HardwareToLogical(joystick->button, joystick->joystickId) == GamepadButton::East)
+        {
+            EventTimeScaleNext();
+        }
+    }
+}
+
+void Game::StartBackground()
+{
+    backgroundTexture = ctx.resources.FetchTexture(BACKGROUND_TEXTURE);
+    background.setTexture(backgroundTexture.Get());
 }
 
 void Game::Update()
@@ -223,13 +263,13 @@ void Game::EventObstacleSpawn()
     float topHeight = centerY - gapSize / 2;
     float bottomHeight = gConfig.windowSize.y - (centerY + gapSize / 2);
 
-    obstacle.top.setTexture(ctx.resources.FetchTexture(PIPE_TEXTURE_FILENAME));
+    obstacle.top.setTexture(pipeTexture.Get());
     obstacle.top.setFillColor(BACKGROUND_COLOR);
     obstacle.top.setSize({OBSTACLE_WIDTH, topHeight});
     obstacle.top.setOrigin(obstacle.top.getGeometricCenter());
     obstacle.top.setPosition({gConfig.windowSize.x + OBSTACLE_WIDTH / 2, topHeight / 2});
 
-    obstacle.bottom.setTexture(ctx.resources.FetchTexture(PIPE_TEXTURE_FILENAME));
+    obstacle.bottom.setTexture(pipeTexture.Get());
     obstacle.bottom.setFillColor(BACKGROUND_COLOR);
     obstacle.bottom.setSize({OBSTACLE_WIDTH, bottomHeight});
     obstacle.bottom.setOrigin(obstacle.bottom.getGeometricCenter());
@@ -253,6 +293,8 @@ void Game::EventGenerationNext()
         eliteWeights[i] = generation.birds[i].weights;
     }
 
+    Random& ai = ctx.random.Stream(RandomStream::AI);
+
     for (int i = 0; i < BIRD_COUNT; i++)
     {
         EventRestartBird(generation.birds[i]);
@@ -262,19 +304,22 @@ void Game::EventGenerationNext()
             continue;
         }
 
-        int eliteIndex = ctx.random.Int(0, GENERATION_ELITE_COUNT - 1);
+        int eliteIndex = ai.Int(0, GENERATION_ELITE_COUNT - 1);
         const std::array<float, 4>& parentWeights = eliteWeights[eliteIndex];
 
+        std::array<float, BIRD_WEIGHT_COUNT> mutations;
+        ai.Fill(mutations, -0.1f, 0.1f);
+
         for (std::size_t j = 0; j < parentWeights.size(); j++)
         {
-            generation.birds[i].weights[j] = parentWeights[j] + ctx.random.Float(-0.1f, 0.1f);
+            generation.birds[i].weights[j] = parentWeights[j] + mutations[j];
         }
     }
 
     EventGenerationNextStats();
     EventObstacleSpawn();
 
-    clock.restart();
+    generationTimer.Restart();
 }
 
 void Game::EventGenerationNextStats()
@@ -289,6 +334,14 @@ void Game::EventGenerationNextStats()
     generation.scoreText.setString("Score: " + std::to_string(generation.score));
 }
 
+void Game::EventTimeScaleNext()
+{
+    generation.timeScale = (generation.timeScale + 1) % TIME_SCALES.size();
+    generation.timeScaleText.setString(std::format("Speed: x{}", TIME_SCALES[generation.timeScale]));
+
+    ctx.time.SetTimeScale(TIME_SCALES[generation.timeScale]);
+}
+
 void Game::HandleCollisions()
 {
     HandleCollisionsBirds();
@@ -314,7 +367,7 @@ void Game::HandleCollisionsBirds()
 void Game::ResolveCollisionBird(Bird& bird)
 {
     bird.alive = false;
-    bird.timeAlive = clock.getElapsedTime().asSeconds();
+    bird.timeAlive = generationTimer.GetElapsedTime();
 
     generation.birdCount--;
     generation.birdCountText.setString("Birds: " + std::to_string(generation.birdCount));
@@ -394,16 +447,22 @@ void Game::Render() const
     ctx.renderer.Draw(generation.indexText);
     ctx.renderer.Draw(generation.birdCountText);
     ctx.renderer.Draw(generation.scoreText);
+    ctx.renderer.Draw(generation.timeScaleText);
 }
 
-void Game::OnPause(bool paused)
+bool Game::IsOpaque() const
 {
-    if (paused)
-    {
-        clock.stop();
-    }
-    else
-    {
-        clock.start();
-    }
+    return true;
+}
+
+ResourceManifest Game::GetManifest() const
+{
+    return {.textures = {BIRD_TEXTURE, PIPE_TEXTURE, BACKGROUND_TEXTURE}};
+}
+
+void Game::OnCleanup()
+{
+    birdTexture = {};
+    pipeTexture = {};
+    backgroundTexture = {};
 }
\ No newline at end of file
@@ -12,6 +12,8 @@ Game::Game(EngineContext& context) :
     InitInfos();
     InitSelected();
     InitBackground();
+
+    PrewarmGlyphs(INFOS_TEXT_SIZE, PRINTABLE_CHARACTERS, 1);
 }
 
 void Game::InitInfos()
@@ -29,7 +31,6 @@ void Game::InitSelected()
 
 void Game::InitBackground()
 {
-    background.setTexture(ctx.resources.FetchTexture(BACKGROUND_TEXTURE_FILENAME));
     background.setFillColor(BACKGROUND_COLOR);
     background.setSize(gConfig.windowSize);
 }
@@ -42,6 +43,7 @@ void Game::Start()
     StartMap();
     StartInfos();
     StartSelected();
+    StartBackground();
 
     showTileset = false;
 
@@ -76,7 +78,8 @@ void Game::StartCamera()
 
 void Game::StartMap()
 {
-    map.Init(TILEMAP_TEXTURE_FILENAME, TILE_SIZE, MAP_SIZE);
+    tilesetTexture = ctx.resources.FetchTexture(TILEMAP_TEXTURE);
+    map.Init(*tilesetTexture, TILE_SIZE, MAP_SIZE);
 
     preview.setSize(sf::Vector2f(map.GetTileSize()));
     preview.setTexture(&map.GetTexture());
@@ -104,6 +107,12 @@ void Game::StartSelected()
     EventTileSelect();
 }
 
+void Game::StartBackground()
+{
+    backgroundTexture = ctx.resources.FetchTexture(BACKGROUND_TEXTURE);
+    background.setTexture(backgroundTexture.Get());
+}
+
 void Game::OnEvent(const sf::Event& event)
 {
     event.visit([this](const auto& type) { this->HandleEvent(type); });
@@ -154,7 +163,7 @@ void Game::HandleEvent(const sf::Event::KeyPressed& key)
         {
             if (key.control)
             {
-                VERIFY(map.LoadFromFile(TILEMAP_LEVEL_FILENAME, TILEMAP_TEXTURE_FILENAME));
+                VERIFY(map.LoadFromFile(TILEMAP_LEVEL_FILENAME, *tilesetTexture));
             }
             break;
         }
@@ -201,7 +210,7 @@ void Game::HandleEvent(const sf::Event::JoystickButtonPressed& joystick)
         }
         case GamepadButton::R1:
         {
-            VERIFY(map.LoadFromFile(TILEMAP_LEVEL_FILENAME, TILEMAP_TEXTURE_FILENAME));
+            VERIFY(map.LoadFromFile(TILEMAP_LEVEL_FILENAME, *tilesetTexture));
             break;
         }
         case GamepadButton::North:
@@ -368,6 +377,22 @@ void Game::Render() const
     }
 }
 
+bool Game::IsOpaque() const
+{
+    return true;
+}
+
+ResourceManifest Game::GetManifest() const
+{
+    return {.textures = {TILEMAP_TEXTURE, BACKGROUND_TEXTURE}};
+}
+
+void Game::OnCleanup()
+{
+    tilesetTexture = {};
+    backgroundTexture = {};
+}
+
 void Game::RenderGrid() const
 {
     sf::Vector2i mapPixelSize(map.GetMapSize().componentWiseMul(map.GetTileSize()));
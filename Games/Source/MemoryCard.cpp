@@ -28,6 +28,8 @@ void Game::StartStats()
 
 void Game::StartCards()
 {
+    cardTexture = ctx.resources.FetchTexture(CARD_TEXTURE);
+
     EventCardsSpawn();
 }
 
@@ -83,7 +85,7 @@ void Game::EventCardSpawn(sf::FloatRect bounds, sf::Color color)
 {
     auto& card = cards.emplace_back();
 
-    card.shape.setTexture(ctx.resources.FetchTexture(CARD_TEXTURE_FILENAME));
+    card.shape.setTexture(cardTexture.Get());
     card.shape.setFillColor(sf::Color::Transparent);
     card.shape.setOutlineColor(CARD_OUTLINE_COLOR);
     card.shape.setOutlineThickness(-1);
@@ -163,7 +165,7 @@ std::vector<sf::Color> Game::GenerateCardColors() const
         colors.emplace_back(color);
     }
 
-    std::ranges::shuffle(colors, std::default_random_engine(std::random_device{}()));
+    std::ranges::shuffle(colors, ctx.random.Stream(RandomStream::Gameplay));
 
     return colors;
 }
@@ -186,14 +188,12 @@ void Game::Render() const
     }
 }
 
-void Game::OnPause(bool paused)
+ResourceManifest Game::GetManifest() const
 {
-    if (paused)
-    {
-        cardPair.visibleCooldown.Stop();
-    }
-    else
-    {
-        cardPair.visibleCooldown.Start();
-    }
+    return {.textures = {CARD_TEXTURE}};
+}
+
+void Game::OnCleanup()
+{
+    cardTexture = {};
 }
\ No newline at end of file
@@ -6,11 +6,13 @@ using namespace Menu;
 
 Game::Game(EngineContext& context) :
     Scene(context),
-    music(*ctx.resources.FetchMusic(MUSIC_FILENAME))
+    music(*ctx.resources.FetchMusic(MUSIC))
 {
     InitButtons();
     InitControls();
     InitMusic();
+
+    PrewarmGlyphs(BUTTON_TEXT_SIZE);
 }
 
 void Game::InitButtons()
@@ -44,7 +46,6 @@ void Game::InitButtons()
 
 void Game::InitButton(Button& button, sf::FloatRect bounds, std::string name)
 {
-    button.shape.setTexture(ctx.resources.FetchTexture(BUTTON_TEXTURE_FILENAME));
     button.shape.setFillColor(BUTTON_COLOR);
     button.shape.setSize(bounds.size);
     button.shape.setOrigin(button.shape.getGeometricCenter());
@@ -85,10 +86,21 @@ void Game::InitMusic()
 
 void Game::Start()
 {
+    StartButtons();
     StartControls();
     StartMusic();
 }
 
+void Game::StartButtons()
+{
+    buttonTexture = ctx.resources.FetchTexture(BUTTON_TEXTURE);
+
+    for (auto& button : buttons)
+    {
+        button.shape.setTexture(buttonTexture.Get());
+    }
+}
+
 void Game::StartControls()
 {
     controls.current.reset();
@@ -154,6 +166,12 @@ void Game::UpdateButton(Button& button)
     if (button.shape.getFillColor() != color)
     {
         button.shape.setFillColor(color);
+
+        // Entering a button starts loading its game in the background
+        if (IsButtonHovered(button))
+        {
+            ctx.scenes.PrefetchScene(button.name);
+        }
     }
 }
 
@@ -223,4 +241,6 @@ void Game::OnPause(bool paused)
 void Game::OnCleanup()
 {
     music.stop();
+
+    buttonTexture = {};
 }
\ No newline at end of file
@@ -5,16 +5,17 @@
 using namespace MineStorm;
 
 Game::Game(EngineContext& context) :
-    Scene(context),
-    explosionTexture(*ctx.resources.FetchTexture(EXPLOSION_TEXTURE_FILENAME))
+    Scene(context)
 {
     InitPlayer();
+    InitEnemyMeshes();
     InitBackground();
+
+    PrewarmGlyphs(DEFAULT_CHARACTER_SIZE, PRINTABLE_CHARACTERS, 1);
 }
 
 void Game::InitPlayer()
 {
-    player.shape.setTexture(ctx.resources.FetchTexture(PLAYER_TEXTURE_FILENAME));
     player.shape.setFillColor(PLAYER_COLOR);
     player.shape.setSize(PLAYER_SIZE);
     player.shape.setOrigin(player.shape.getGeometricCenter());
@@ -32,12 +33,17 @@ void Game::InitPlayer()
     player.shieldCooldown.SetDuration(PLAYER_SHIELD_COOLDOWN_DURATION);
 }
 
+void Game::InitEnemyMeshes()
+{
+    for (const auto& points : ENEMY_SHAPES)
+    {
+        enemyMeshes.emplace_back(points);
+    }
+}
+
 void Game::InitBackground()
 {
-    background.setTexture(ctx.resources.FetchTexture(BACKGROUND_TEXTURE_FILENAME));
     background.setSize(gConfig.windowSize);
-
-    foreground.setTexture(ctx.resources.FetchTexture(FOREGROUND_TEXTURE_FILENAME));
     foreground.setSize(background.getSize());
 }
 
@@ -48,6 +54,8 @@ void Game::Start()
     BindInputs();
 
     StartPlayer();
+    StartBackground();
+    StartExplosions();
 
     EventWaveNew();
 }
@@ -72,6 +80,9 @@ void Game::BindInputs()
 
 void Game::StartPlayer()
 {
+    playerTexture = ctx.resources.FetchTexture(PLAYER_TEXTURE);
+    player.shape.setTexture(playerTexture.Get());
+
     player.stats.score = 0;
     player.stats.scoreText.setString("Score: 0");
     player.stats.scoreText.setPosition({50, 40});
@@ -81,6 +92,23 @@ void Game::StartPlayer()
     player.stats.livesText.setPosition(player.stats.scoreText.getPosition() + offset);
 }
 
+void Game::StartBackground()
+{
+    backgroundTexture = ctx.resources.FetchTexture(BACKGROUND_TEXTURE);
+    background.setTexture(backgroundTexture.Get());
+
+    foregroundTexture = ctx.resources.FetchTexture(FOREGROUND_TEXTURE);
+    foreground.setTexture(foregroundTexture.Get());
+}
+
+void Game::StartExplosions()
+{
+    // The batch references the clip, which references the texture, so all three are rebuilt together
+    explosionTexture = ctx.resources.FetchTexture(EXPLOSION_TEXTURE);
+    explosionAnimation.emplace(*explosionTexture, EXPLOSION_ANIMATION_FRAMES_PER_ROW, EXPLOSION_ANIMATION_DURATION, false);
+    explosions.emplace(*explosionAnimation);
+}
+
 void Game::Update()
 {
     if (ctx.input.Pressed(Shoot) && player.shootCooldown.IsOver())
@@ -89,7 +117,7 @@ void Game::Update()
         player.shootCooldown.Restart();
     }
 
-    if (enemies.empty())
+    if (enemies.IsEmpty())
     {
         EventWaveNew();
     }
@@ -100,6 +128,8 @@ void Game::Update()
     UpdateExplosions();
 
     HandleCollisions();
+
+    UpdateEnemyBatch();
 }
 
 void Game::UpdatePlayer()
@@ -161,7 +191,7 @@ void Game::UpdateEnemy(Enemy& enemy)
         case Magnetic:
         case MagneticFireball:
         {
-            sf::Vector2f direction = player.shape.getPosition() - enemy.shape.getPosition();
+            sf::Vector2f direction = player.shape.getPosition() - enemy.transform.getPosition();
             enemy.direction = (direction.lengthSquared() > 0) ? direction.normalized() : sf::Vector2f();
         }
         break;
@@ -169,7 +199,7 @@ void Game::UpdateEnemy(Enemy& enemy)
             break;
     }
 
-    enemy.shape.move(enemy.direction * enemy.speed * ctx.time.GetDeltaTime());
+    enemy.transform.move(enemy.direction * enemy.speed * ctx.time.GetDeltaTime());
 }
 
 void Game::UpdateBullets()
@@ -182,19 +212,30 @@ void Game::UpdateBullets()
 
 void Game::UpdateExplosions()
 {
-    for (auto& explosion : explosions)
+    explosions->Update(ctx.time.GetDeltaTime());
+    explosions->RemoveFinished();
+}
+
+void Game::UpdateEnemyBatch()
+{
+    enemyBatch.Clear();
+
+    for (const auto& enemy : enemies)
     {
-        explosion.shape.Update(ctx.time.GetDeltaTime());
+        enemyBatch.Add(enemyMeshes[enemy.type - 1], enemy.transform.getTransform(), enemy.color);
     }
-
-    std::erase_if(explosions, [](const Explosion& explosion) {
-        return explosion.shape.IsFinished();
-    });
 }
 
 void Game::EventPlayerShoot()
 {
-    auto& bullet = bullets.emplace_back();
+    Bullet* spawned = bullets.Spawn();
+
+    if (!spawned)
+    {
+        return;
+    }
+
+    auto& bullet = *spawned;
 
     bullet.shape.setFillColor(PLAYER_BULLET_COLOR);
     bullet.shape.setRadius(PLAYER_BULLET_RADIUS);
@@ -221,9 +262,9 @@ void Game::EventPlayerShipReset()
 
 void Game::EventWaveNew()
 {
-    enemies.clear();
-    bullets.clear();
-    explosions.clear();
+    enemies.Clear();
+    bullets.Clear();
+    explosions->Clear();
 
     int totalChildren = (int)std::pow(ENEMY_CHILD_COUNT, ENEMY_SIZE) - 1;
     wave.spawns.resize(ENEMY_COUNT * totalChildren);
@@ -247,26 +288,26 @@ void Game::EventWaveNew()
 
 void Game::EventEnemySpawn()
 {
-    auto& enemy = enemies.emplace_back();
+    Enemy* spawned = enemies.Spawn();
+
+    if (!spawned)
+    {
+        return;
+    }
 
-    enemy.shape.setPosition(wave.spawns.back().getPosition());
+    auto& enemy = *spawned;
+
+    enemy.transform.setPosition(wave.spawns.back().getPosition());
     wave.spawns.pop_back();
 
     EnemySettings settings = wave.enemies.front();
     wave.enemies.pop();
 
     enemy.type = settings.type;
-    enemy.shape.setFillColor(ENEMY_COLORS[enemy.type - 1]);
+    enemy.color = ENEMY_COLORS[enemy.type - 1];
 
     enemy.size = settings.size;
-    enemy.shape.setScale({enemy.size * ENEMY_SCALE, enemy.size * ENEMY_SCALE});
-
-    auto& points = ENEMY_SHAPES[enemy.type - 1];
-    enemy.shape.setPointCount(points.size());
-    for (std::size_t i = 0; i < points.size(); i++)
-    {
-        enemy.shape.setPoint(i, points[i]);
-    }
+    enemy.transform.setScale({enemy.size * ENEMY_SCALE, enemy.size * ENEMY_SCALE});
 
     enemy.direction = {1, ctx.random.Angle(sf::Angle::Zero, sf::degrees(360))};
     enemy.speed = ENEMY_SPEED / (int)enemy.type * (ENEMY_SIZE / enemy.size + 1);
@@ -276,19 +317,26 @@ void Game::EventEnemySpawn()
 
 void Game::EventEnemyShoot(const Enemy& enemy)
 {
-    sf::Vector2f direction = player.shape.getPosition() - enemy.shape.getPosition();
+    sf::Vector2f direction = player.shape.getPosition() - enemy.transform.getPosition();
 
     if (direction.lengthSquared() == 0)
     {
         return;
     }
 
-    auto& bullet = bullets.emplace_back();
+    Bullet* spawned = bullets.Spawn();
+
+    if (!spawned)
+    {
+        return;
+    }
+
+    auto& bullet = *spawned;
 
     bullet.shape.setFillColor(ENEMY_BULLET_COLOR);
     bullet.shape.setRadius(ENEMY_BULLET_RADIUS);
     bullet.shape.setOrigin(bullet.shape.getGeometricCenter());
-    bullet.shape.setPosition(enemy.shape.getPosition());
+    bullet.shape.setPosition(enemy.transform.getPosition());
 
     bullet.direction = direction.normalized();
     bullet.speed = ENEMY_BULLET_SPEED;
@@ -315,20 +363,21 @@ void Game::EventEnemyDead(const Enemy& enemy)
     player.stats.score++;
     player.stats.scoreText.setString("Score: " + std::to_string(player.stats.score));
 
-    EventExplosion(enemy.shape);
+    EventExplosion(enemy);
 }
 
 void Game::EventExplosion(const sf::Shape& shape)
 {
-    auto& explosion = explosions.emplace_back();
-
-    explosion.shape.Start({&explosionTexture, EXPLOSION_ANIMATION_FRAMES_PER_ROW,
-                           EXPLOSION_ANIMATION_DURATION, false});
+    explosions->Add(shape.getPosition(),
+                    shape.getGlobalBounds().size * EXPLOSION_SCALE,
+                    shape.getFillColor() * EXPLOSION_COLOR_FACTOR);
+}
 
-    explosion.shape.setFillColor(shape.getFillColor() * EXPLOSION_COLOR_FACTOR);
-    explosion.shape.setSize(shape.getGlobalBounds().size * EXPLOSION_SCALE);
-    explosion.shape.setOrigin(explosion.shape.getGeometricCenter());
-    explosion.shape.setPosition(shape.getPosition());
+void Game::EventExplosion(const Enemy& enemy)
+{
+    explosions->Add(enemy.transform.getPosition(),
+                    GetEnemyBounds(enemy).size * EXPLOSION_SCALE,
+                    enemy.color * EXPLOSION_COLOR_FACTOR);
 }
 
 sf::CircleShape Game::GenerateSpawnPoint() const
@@ -342,6 +391,11 @@ sf::CircleShape Game::GenerateSpawnPoint() const
     return spawn;
 }
 
+sf::FloatRect Game::GetEnemyBounds(const Enemy& enemy) const
+{
+    return enemy.transform.getTransform().transformRect(enemyMeshes[enemy.type - 1].GetBounds());
+}
+
 void Game::HandleCollisions()
 {
     HandleCollisionsPlayerMap();
@@ -356,7 +410,8 @@ void Game::HandleCollisions()
         return;
     }
 
-    while (!wave.enemies.empty())
+    // Children that do not fit yet stay queued until earlier enemies are destroyed
+    while (!wave.enemies.empty() && !enemies.IsFull())
     {
         EventEnemySpawn();
     }
@@ -364,14 +419,14 @@ void Game::HandleCollisions()
 
 void Game::HandleCollisionsPlayerMap()
 {
-    HandleCollisionsShapeMap(player.shape);
+    HandleCollisionsShapeMap(player.shape, player.shape.getGlobalBounds().size);
 }
 
 void Game::HandleCollisionsPlayerEnemies()
 {
     for (auto& enemy : enemies)
     {
-        if (player.shieldCooldown.IsOver() && Intersects(player.shape, enemy.shape))
+        if (player.shieldCooldown.IsOver() && Intersects(player.shape, GetEnemyBounds(enemy)))
         {
             ResolveCollisionPlayerEnemy();
         }
@@ -391,30 +446,31 @@ void Game::HandleCollisionsEnemiesMap()
 {
     for (auto& enemy : enemies)
     {
-        HandleCollisionsShapeMap(enemy.shape);
+        HandleCollisionsShapeMap(enemy.transform, GetEnemyBounds(enemy).size);
     }
 }
 
-void Game::HandleCollisionsShapeMap(sf::Shape& shape)
+void Game::HandleCollisionsShapeMap(sf::Transformable& shape, sf::Vector2f size)
 {
     sf::Vector2f lastPosition = shape.getPosition();
+    sf::Vector2f halfSize = size / 2.f;
 
-    if (IsOutsideWindowLeft(shape))
+    if (lastPosition.x < halfSize.x)
     {
-        shape.setPosition({gConfig.windowSize.x - shape.getGlobalBounds().size.x / 2, lastPosition.y});
+        shape.setPosition({gConfig.windowSize.x - halfSize.x, lastPosition.y});
     }
-    else if (IsOutsideWindowRight(shape))
+    else if (lastPosition.x > gConfig.windowSize.x - halfSize.x)
     {
-        shape.setPosition({shape.getGlobalBounds().size.x / 2, lastPosition.y});
+        shape.setPosition({halfSize.x, lastPosition.y});
     }
 
-    if (IsOutsideWindowTop(shape))
+    if (lastPosition.y < halfSize.y)
     {
-        shape.setPosition({lastPosition.x, gConfig.windowSize.y - shape.getGlobalBounds().size.y / 2});
+        shape.setPosition({lastPosition.x, gConfig.windowSize.y - halfSize.y});
     }
-    else if (IsOutsideWindowBottom(shape))
+    else if (lastPosition.y > gConfig.windowSize.y - halfSize.y)
     {
-        shape.setPosition({lastPosition.x, shape.getGlobalBounds().size.y / 2});
+        shape.setPosition({lastPosition.x, halfSize.y});
     }
 }
 
@@ -435,7 +491,7 @@ void Game::HandleCollisionsBullets()
         }
     }
 
-    std::erase_if(bullets, [](const Bullet& bullet) {
+    bullets.RemoveIf([](const Bullet& bullet) {
         return !bullet.alive || IsOutsideWindow(bullet.shape.getPosition());
     });
 
@@ -447,7 +503,7 @@ void Game::HandleCollisionsBullets()
         }
     }
 
-    std::erase_if(enemies, [](const Enemy& enemy) { return enemy.lives <= 0; });
+    enemies.RemoveIf([](const Enemy& enemy) { return enemy.lives <= 0; });
 }
 
 void Game::ResolveCollisionBulletPlayer(Bullet& bullet)
@@ -465,7 +521,7 @@ void Game::HandleCollisionsBulletEnemies(Bullet& bullet)
 {
     for (auto& enemy : enemies)
     {
-        if (enemy.lives > 0 && bullet.alive && Intersects(bullet.shape, enemy.shape))
+        if (enemy.lives > 0 && bullet.alive && Intersects(bullet.shape, GetEnemyBounds(enemy)))
         {
             ResolveCollisionBulletEnemy(bullet, enemy);
         }
@@ -482,10 +538,7 @@ void Game::Render() const
 {
     ctx.renderer.Draw(background);
 
-    for (const auto& enemy : enemies)
-    {
-        ctx.renderer.Draw(enemy.shape);
-    }
+    ctx.renderer.Draw(enemyBatch);
 
     for (const auto& bullet : bullets)
     {
@@ -497,10 +550,7 @@ void Game::Render() const
         ctx.renderer.Draw(spawn);
     }
 
-    for (const auto& explosion : explosions)
-    {
-        ctx.renderer.Draw(explosion.shape);
-    }
+    ctx.renderer.Draw(*explosions);
 
     ctx.renderer.Draw(player.shape);
 
@@ -515,16 +565,23 @@ void Game::Render() const
     ctx.renderer.Draw(player.stats.livesText);
 }
 
-void Game::OnPause(bool paused)
+bool Game::IsOpaque() const
 {
-    if (paused)
-    {
-        player.shootCooldown.Stop();
-        player.shieldCooldown.Stop();
-    }
-    else
-    {
-        player.shootCooldown.Start();
-        player.shieldCooldown.Start();
-    }
+    return true;
+}
+
+ResourceManifest Game::GetManifest() const
+{
+    return {.textures = {PLAYER_TEXTURE, BACKGROUND_TEXTURE, FOREGROUND_TEXTURE, EXPLOSION_TEXTURE}};
+}
+
+void Game::OnCleanup()
+{
+    explosions.reset();
+    explosionAnimation.reset();
+
+    playerTexture = {};
+    backgroundTexture = {};
+    foregroundTexture = {};
+    explosionTexture = {};
 }
\ No newline at end of file
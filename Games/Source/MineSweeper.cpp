@@ -10,6 +10,8 @@ Game::Game(EngineContext& context) :
 {
     InitGrid();
     InitStats();
+
+    PrewarmGlyphs(unsigned(CELL_SIZE) - 10, DIGIT_CHARACTERS);
 }
 
 void Game::InitGrid()
@@ -8,6 +8,8 @@ Game::Game(EngineContext& context) :
     Scene(context)
 {
     InitGrid();
+
+    PrewarmGlyphs(CELL_TEXT_SIZE, DIGIT_CHARACTERS);
 }
 
 void Game::InitGrid()
@@ -100,7 +102,7 @@ void Game::StartCell(Cell& cell, sf::Vector2i tile)
 
 void Game::StartStats()
 {
-    stats.previousPressed = false;
+    stats.animationProgress = 0;
 }
 
 void Game::OnEvent(const sf::Event& event)
@@ -161,20 +163,16 @@ void Game::UpdateActions()
         return;
     }
 
-    bool left  = ctx.input.Pressed(MoveLeft);
-    bool down  = ctx.input.Pressed(MoveDown);
-    bool right = ctx.input.Pressed(MoveRight);
-    bool up    = ctx.input.Pressed(MoveUp);
+    bool left  = ctx.input.JustPressed(MoveLeft);
+    bool down  = ctx.input.JustPressed(MoveDown);
+    bool right = ctx.input.JustPressed(MoveRight);
+    bool up    = ctx.input.JustPressed(MoveUp);
 
-    bool currentPressed = left || down || right || up;
-
-    if (currentPressed && !stats.previousPressed)
+    if (left || down || right || up)
     {
-        int turns = left ? 0 : down ? 1 : right ? 2 : up ? 3 : -1;
+        int turns = left ? 0 : down ? 1 : right ? 2 : 3;
         EventCellAction(turns);
     }
-
-    stats.previousPressed = currentPressed;
 }
 
 void Game::UpdateAnimation()
@@ -238,7 +236,7 @@ void Game::UpdateAnimationFinishedCell(Cell& cell)
 
 void Game::EventCellNew()
 {
-    std::vector<sf::Vector2i> emptyCells = GetEmptyCells();
+    std::pmr::vector<sf::Vector2i> emptyCells = GetEmptyCells();
 
     if (emptyCells.empty())
     {
@@ -351,9 +349,9 @@ void Game::EventCellsMerge(Cell& fromCell, Cell& toCell)
     stats.animationProgress = 0;
 }
 
-std::vector<sf::Vector2i> Game::GetEmptyCells() const
+std::pmr::vector<sf::Vector2i> Game::GetEmptyCells() const
 {
-    std::vector<sf::Vector2i> emptyCells;
+    std::pmr::vector<sf::Vector2i> emptyCells(&ctx.arena);
 
     for (int i = 0; i < GRID_SIZE; i++)
     {
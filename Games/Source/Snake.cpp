@@ -5,13 +5,13 @@
 using namespace Snake;
 
 Game::Game(EngineContext& context) :
-    Scene(context),
-    tilesetTexture(*ctx.resources.FetchTexture(TILEMAP_TEXTURE_FILENAME)),
-    bonusSound(*ctx.resources.FetchSound(BONUS_SOUND_FILENAME))
+    Scene(context)
 {
     InitMap();
     InitPlayer();
     InitBonus();
+
+    PrewarmGlyphs(DEFAULT_CHARACTER_SIZE, PRINTABLE_CHARACTERS, 2);
 }
 
 void Game::InitMap()
@@ -57,38 +57,33 @@ void Game::InitPlayerTextures()
 {
     sf::Vector2i size(64, 64);
 
-    player.texturesRect.emplace("Head Up",    sf::IntRect({3 * 64, 0},      size));
-    player.texturesRect.emplace("Head Down",  sf::IntRect({4 * 64, 1 * 64}, size));
-    player.texturesRect.emplace("Head Left",  sf::IntRect({3 * 64, 1 * 64}, size));
-    player.texturesRect.emplace("Head Right", sf::IntRect({4 * 64, 0},      size));
-
-    player.texturesRect.emplace("Body Vertical",   sf::IntRect({2 * 64, 1 * 64}, size));
-    player.texturesRect.emplace("Body Horizontal", sf::IntRect({1 * 64, 0 * 64}, size));
+    player.texturesRect[std::size_t(PartTexture::HeadUp)]    = sf::IntRect({3 * 64, 0},      size);
+    player.texturesRect[std::size_t(PartTexture::HeadDown)]  = sf::IntRect({4 * 64, 1 * 64}, size);
+    player.texturesRect[std::size_t(PartTexture::HeadLeft)]  = sf::IntRect({3 * 64, 1 * 64}, size);
+    player.texturesRect[std::size_t(PartTexture::HeadRight)] = sf::IntRect({4 * 64, 0},      size);
 
-    player.texturesRect.emplace("Corner Up Right / Left Down", sf::IntRect({0 * 64, 0 * 64}, size));
-    player.texturesRect.emplace("Corner Down Right / Left Up", sf::IntRect({0 * 64, 1 * 64}, size));
-    player.texturesRect.emplace("Corner Up Left / Right Down", sf::IntRect({2 * 64, 0 * 64}, size));
-    player.texturesRect.emplace("Corner Down Left / Right Up", sf::IntRect({2 * 64, 2 * 64}, size));
+    player.texturesRect[std::size_t(PartTexture::BodyVertical)]   = sf::IntRect({2 * 64, 1 * 64}, size);
+    player.texturesRect[std::size_t(PartTexture::BodyHorizontal)] = sf::IntRect({1 * 64, 0 * 64}, size);
 
-    player.texturesRect.emplace("Tail Up",    sf::IntRect({3 * 64, 2 * 64}, size));
-    player.texturesRect.emplace("Tail Down",  sf::IntRect({4 * 64, 3 * 64}, size));
-    player.texturesRect.emplace("Tail Left",  sf::IntRect({3 * 64, 3 * 64}, size));
-    player.texturesRect.emplace("Tail Right", sf::IntRect({4 * 64, 2 * 64}, size));
+    player.texturesRect[std::size_t(PartTexture::CornerUpRight)]   = sf::IntRect({0 * 64, 0 * 64}, size);
+    player.texturesRect[std::size_t(PartTexture::CornerDownRight)] = sf::IntRect({0 * 64, 1 * 64}, size);
+    player.texturesRect[std::size_t(PartTexture::CornerUpLeft)]    = sf::IntRect({2 * 64, 0 * 64}, size);
+    player.texturesRect[std::size_t(PartTexture::CornerDownLeft)]  = sf::IntRect({2 * 64, 2 * 64}, size);
 
-    player.texturesRect.emplace("Apple", sf::IntRect({0 * 64, 3 * 64}, size));
+    player.texturesRect[std::size_t(PartTexture::TailUp)]    = sf::IntRect({3 * 64, 2 * 64}, size);
+    player.texturesRect[std::size_t(PartTexture::TailDown)]  = sf::IntRect({4 * 64, 3 * 64}, size);
+    player.texturesRect[std::size_t(PartTexture::TailLeft)]  = sf::IntRect({3 * 64, 3 * 64}, size);
+    player.texturesRect[std::size_t(PartTexture::TailRight)] = sf::IntRect({4 * 64, 2 * 64}, size);
 
-    player.head.shape.setTexture(&tilesetTexture);
+    player.texturesRect[std::size_t(PartTexture::Apple)] = sf::IntRect({0 * 64, 3 * 64}, size);
 }
 
 void Game::InitBonus()
 {
-    bonus.shape.setTexture(&tilesetTexture);
-    bonus.shape.setTextureRect(player.texturesRect.at("Apple"));
+    bonus.shape.setTextureRect(GetTextureRect(PartTexture::Apple));
     bonus.shape.setFillColor(BONUS_COLOR);
     bonus.shape.setSize(player.head.shape.getSize() * 0.8f);
     bonus.shape.setOrigin(bonus.shape.getGeometricCenter());
-
-    bonusSound.setVolume(BONUS_SOUND_VOLUME);
 }
 
 void Game::Start()
@@ -97,6 +92,11 @@ void Game::Start()
     
     BindInputs();
 
+    tilesetTexture = ctx.resources.FetchTexture(TILEMAP_TEXTURE);
+    player.head.shape.setTexture(tilesetTexture.Get());
+    bonus.shape.setTexture(tilesetTexture.Get());
+    bonusSound = ctx.resources.FetchSound(BONUS_SOUND);
+
     StartPlayer();
 
     EventBonusSpawn();
@@ -277,7 +277,7 @@ void Game::EventPlayerGrow()
 {
     auto& tail = player.body.emplace_back();
 
-    tail.shape.setTexture(&tilesetTexture);
+    tail.shape.setTexture(tilesetTexture.Get());
     tail.shape.setFillColor(PLAYER_COLOR);
     tail.shape.setSize(player.head.shape.getSize());
     tail.shape.setOrigin(tail.shape.getGeometricCenter());
@@ -301,8 +301,8 @@ void Game::EventCornerSpawn()
 {
     auto& corner = player.corners.emplace_back();
 
-    corner.shape.setTexture(&tilesetTexture);
-    corner.shape.setTextureRect(player.texturesRect.at(GetCornerTextureKey()));
+    corner.shape.setTexture(tilesetTexture.Get());
+    corner.shape.setTextureRect(GetTextureRect(GetCornerTexture()));
     corner.shape.setFillColor(PLAYER_COLOR);
     corner.shape.setSize(player.head.shape.getSize());
     corner.shape.setOrigin(corner.shape.getGeometricCenter());
@@ -320,10 +320,10 @@ void Game::EventPlayerHeadChangeTexture(Part& head)
 {
     switch (head.direction)
     {
-        case Direction::Up:    head.shape.setTextureRect(player.texturesRect.at("Head Up"));    break;
-        case Direction::Down:  head.shape.setTextureRect(player.texturesRect.at("Head Down"));  break;
-        case Direction::Left:  head.shape.setTextureRect(player.texturesRect.at("Head Left"));  break;
-        case Direction::Right: head.shape.setTextureRect(player.texturesRect.at("Head Right")); break;
+        case Direction::Up:    head.shape.setTextureRect(GetTextureRect(PartTexture::HeadUp));    break;
+        case Direction::Down:  head.shape.setTextureRect(GetTextureRect(PartTexture::HeadDown));  break;
+        case Direction::Left:  head.shape.setTextureRect(GetTextureRect(PartTexture::HeadLeft));  break;
+        case Direction::Right: head.shape.setTextureRect(GetTextureRect(PartTexture::HeadRight)); break;
         default: break;
     }
 }
@@ -333,9 +333,9 @@ void Game::EventPlayerBodyChangeTexture(Part& body)
     switch (body.direction)
     {
         case Direction::Up:
-        case Direction::Down:  body.shape.setTextureRect(player.texturesRect.at("Body Vertical"));   break;
+        case Direction::Down:  body.shape.setTextureRect(GetTextureRect(PartTexture::BodyVertical));   break;
         case Direction::Left:
-        case Direction::Right: body.shape.setTextureRect(player.texturesRect.at("Body Horizontal")); break;
+        case Direction::Right: body.shape.setTextureRect(GetTextureRect(PartTexture::BodyHorizontal)); break;
         default: break;
     }
 }
@@ -344,10 +344,10 @@ void Game::EventPlayerTailChangeTexture(Part& tail)
 {
     switch (tail.direction)
     {
-        case Direction::Up:    tail.shape.setTextureRect(player.texturesRect.at("Tail Up"));    break;
-        case Direction::Down:  tail.shape.setTextureRect(player.texturesRect.at("Tail Down"));  break;
-        case Direction::Left:  tail.shape.setTextureRect(player.texturesRect.at("Tail Left"));  break;
-        case Direction::Right: tail.shape.setTextureRect(player.texturesRect.at("Tail Right")); break;
+        case Direction::Up:    tail.shape.setTextureRect(GetTextureRect(PartTexture::TailUp));    break;
+        case Direction::Down:  tail.shape.setTextureRect(GetTextureRect(PartTexture::TailDown));  break;
+        case Direction::Left:  tail.shape.setTextureRect(GetTextureRect(PartTexture::TailLeft));  break;
+        case Direction::Right: tail.shape.setTextureRect(GetTextureRect(PartTexture::TailRight)); break;
         default: break;
     }
 }
@@ -416,7 +416,7 @@ void Game::ResolveCollisionPlayerBonus()
     player.stats.score++;
     player.stats.scoreText.setString("Score: " + std::to_string(player.stats.score));
 
-    bonusSound.play();
+    ctx.audio.Play(bonusSound, BONUS_SOUND_PRIORITY, std::nullopt, BONUS_SOUND_VOLUME);
 }
 
 sf::Vector2f Game::GetPlayerHeadNextPosition() const
@@ -430,29 +430,34 @@ sf::Vector2f Game::GetPlayerHeadNextPosition() const
     }
 }
 
-std::string Game::GetCornerTextureKey() const
+PartTexture Game::GetCornerTexture() const
 {
     Direction from = player.head.direction;
     Direction to = player.nextDirection;
 
     if ((from == Direction::Up && to == Direction::Right) || (from == Direction::Left && to == Direction::Down))
     {
-        return "Corner Up Right / Left Down";
+        return PartTexture::CornerUpRight;
     }
     else if ((from == Direction::Down && to == Direction::Right) || (from == Direction::Left && to == Direction::Up))
     {
-        return "Corner Down Right / Left Up";
+        return PartTexture::CornerDownRight;
     }
     else if ((from == Direction::Up && to == Direction::Left) || (from == Direction::Right && to == Direction::Down))
     {
-        return "Corner Up Left / Right Down";
+        return PartTexture::CornerUpLeft;
     }
     else
     {
-        return "Corner Down Left / Right Up";
+        return PartTexture::CornerDownLeft;
     }
 }
 
+const sf::IntRect& Game::GetTextureRect(PartTexture texture) const
+{
+    return player.texturesRect[std::size_t(texture)];
+}
+
 void Game::Render() const
 {
     for (const auto& rect : map.grid)
@@ -478,20 +483,24 @@ void Game::Render() const
     ctx.renderer.Draw(player.stats.scoreText);
 }
 
+ResourceManifest Game::GetManifest() const
+{
+    return {.textures = {TILEMAP_TEXTURE}, .sounds = {BONUS_SOUND}};
+}
+
 void Game::OnPause(bool paused)
 {
     if (paused)
     {
-        player.moveCooldown.Stop();
-        bonusSound.stop();
-    }
-    else
-    {
-        player.moveCooldown.Start();
+        ctx.audio.StopSounds();
     }
 }
 
 void Game::OnCleanup()
 {
-    bonusSound.stop();
+    ctx.audio.StopSounds();
+
+    // Body parts and corners point at the tileset, they are cleared on the next start
+    tilesetTexture = {};
+    bonusSound = {};
 }
\ No newline at end of file
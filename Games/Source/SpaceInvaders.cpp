@@ -9,11 +9,12 @@ Game::Game(EngineContext& context) :
 {
     InitPlayer();
     InitWave();
+
+    PrewarmGlyphs(DEFAULT_CHARACTER_SIZE, PRINTABLE_CHARACTERS, 3);
 }
 
 void Game::InitPlayer()
 {
-    player.shape.setTexture(ctx.resources.FetchTexture(PLAYER_TEXTURE_FILENAME));
     player.shape.setFillColor(PLAYER_COLOR);
     player.shape.setSize(gConfig.windowSize * 0.045f);
     player.shape.setOrigin(player.shape.getGeometricCenter());
@@ -29,10 +30,6 @@ void Game::InitPlayer()
 
 void Game::InitWave()
 {
-    wave.textures = {ctx.resources.FetchTexture(ENEMY_1_TEXTURE_FILENAME),
-                     ctx.resources.FetchTexture(ENEMY_2_TEXTURE_FILENAME),
-                     ctx.resources.FetchTexture(ENEMY_3_TEXTURE_FILENAME)};
-    
     wave.shootCooldown.SetDuration(WAVE_SHOOT_COOLDOWN_DURATION);
 }
 
@@ -42,7 +39,7 @@ void Game::Start()
 
     BindInputs();
 
-    bullets.clear();
+    bullets.Clear();
 
     StartPlayer();
     StartWave();
@@ -65,6 +62,9 @@ void Game::BindInputs()
 
 void Game::StartPlayer()
 {
+    playerTexture = ctx.resources.FetchTexture(PLAYER_TEXTURE);
+    player.shape.setTexture(playerTexture.Get());
+
     player.shape.setPosition({gConfig.windowSize.x / 2, gConfig.windowSize.y - player.shape.getSize().y});
 
     player.stats.score = 0;
@@ -83,6 +83,10 @@ void Game::StartPlayer()
 
 void Game::StartWave()
 {
+    wave.textures = {ctx.resources.FetchTexture(ENEMY_1_TEXTURE),
+                     ctx.resources.FetchTexture(ENEMY_2_TEXTURE),
+                     ctx.resources.FetchTexture(ENEMY_3_TEXTURE)};
+
     wave.enemies.resize(WAVE_COUNT.x);
 
     for (int i = 0; i < WAVE_COUNT.x; i++)
@@ -110,7 +114,7 @@ void Game::StartEnemy(Enemy& enemy, int i, int j)
     sf::Vector2f size = gConfig.windowSize.componentWiseMul({0.04f, 0.03f});
 
     enemy.shape.setFillColor(ENEMY_FULL_COLOR);
-    enemy.shape.setTexture(wave.textures[(j + 1) / 2]);
+    enemy.shape.setTexture(wave.textures[(j + 1) / 2].Get());
     enemy.shape.setSize(size);
     enemy.shape.setOrigin(enemy.shape.getGeometricCenter());
     enemy.shape.setPosition({size.x + size.x * 2 * i, size.y + size.y * 2 * j});
@@ -222,7 +226,14 @@ void Game::UpdateBullets()
 
 void Game::EventPlayerShoot()
 {
-    auto& bullet = bullets.emplace_back();
+    Bullet* spawned = bullets.Spawn();
+
+    if (!spawned)
+    {
+        return;
+    }
+
+    auto& bullet = *spawned;
 
     bullet.shape.setFillColor(PLAYER_BULLET_COLOR);
     bullet.shape.setRadius(PLAYER_BULLET_RADIUS);
@@ -252,7 +263,14 @@ void Game::EventEnemyShoot()
 {
     auto& enemy = wave.enemies[ctx.random.Int(0, (int)wave.enemies.size() - 1)].back();
 
-    auto& bullet = bullets.emplace_back();
+    Bullet* spawned = bullets.Spawn();
+
+    if (!spawned)
+    {
+        return;
+    }
+
+    auto& bullet = *spawned;
 
     bullet.shape.setFillColor(ENEMY_BULLET_COLOR);
     bullet.shape.setRadius(ENEMY_BULLET_RADIUS);
@@ -336,7 +354,7 @@ void Game::HandleCollisionsBullets()
         HandleCollisionsBulletBunkers(bullet);
     }
 
-    std::erase_if(bullets, [](const Bullet& bullet) {
+    bullets.RemoveIf([](const Bullet& bullet) {
         return !bullet.alive || IsOutsideWindow(bullet.shape.getPosition());
     });
 }
@@ -455,4 +473,15 @@ void Game::Render() const
 
     ctx.renderer.Draw(player.stats.scoreText);
     ctx.renderer.Draw(player.stats.livesText);
+}
+
+ResourceManifest Game::GetManifest() const
+{
+    return {.textures = {PLAYER_TEXTURE, ENEMY_1_TEXTURE, ENEMY_2_TEXTURE, ENEMY_3_TEXTURE}};
+}
+
+void Game::OnCleanup()
+{
+    playerTexture = {};
+    wave.textures = {};
 }
\ No newline at end of file
@@ -232,7 +232,7 @@ Piece Game::GenerateRandomPiece() const
     piece.type = ctx.random.Int(0, PIECE_TYPE_COUNT - 1);
     piece.rotation = 0;
     piece.position = {(GRID_WIDTH / 2) - 2, 0};
-    piece.color = ctx.random.Color(sf::Color::Black, sf::Color::White);
+    piece.color = ctx.random.Stream(RandomStream::Cosmetic).Color(sf::Color::Black, sf::Color::White);
 
     return piece;
 }
@@ -325,20 +325,4 @@ void Game::RenderPiece(const Piece& piece, sf::Vector2f origin, bool world) cons
 
         ctx.renderer.Draw(shape);
     }
-}
-
-void Game::OnPause(bool paused)
-{
-    if (paused)
-    {
-        actionCooldown.Stop();
-        fallCooldown.Stop();
-        softDropCooldown.Stop();
-    }
-    else
-    {
-        actionCooldown.Start();
-        fallCooldown.Start();
-        softDropCooldown.Start();
-    }
 }
\ No newline at end of file
@@ -9,6 +9,8 @@ Game::Game(EngineContext& context) :
     restartCooldown(RESTART_COOLDOWN_DURATION)
 {
     InitGrid();
+
+    PrewarmGlyphs(CELL_TEXT_SIZE, "XO");
 }
 
 void Game::InitGrid()
@@ -147,17 +149,17 @@ sf::Vector2i Game::GetCellPositionCursor() const
 
 sf::Vector2i Game::GetCellPositionAI()
 {
-    std::vector<sf::Vector2i> positions = FindCellPositionsEmpty();
+    std::pmr::vector<sf::Vector2i> positions = FindCellPositionsEmpty();
 
     return positions.empty() ? sf::Vector2i(-1, -1) :
            FindCellPositionWinning(positions, 'O').value_or(
            FindCellPositionWinning(positions, 'X').value_or(
-           positions[ctx.random.Int(0, (int)positions.size() - 1)]));
+           positions[ctx.random.Stream(RandomStream::AI).Int(0, (int)positions.size() - 1)]));
 }
 
-std::vector<sf::Vector2i> Game::FindCellPositionsEmpty() const
+std::pmr::vector<sf::Vector2i> Game::FindCellPositionsEmpty() const
 {
-    std::vector<sf::Vector2i> positions;
+    std::pmr::vector<sf::Vector2i> positions(&ctx.arena);
 
     for (int i = 0; i < GRID_SIZE; i++)
     {
@@ -90,21 +90,23 @@ void Game::InitPathRect(sf::RectangleShape& rect)
 
 void Game::InitCastle()
 {
-    castle.shape.setTexture(ctx.resources.FetchTexture(CASTLE_TEXTURE_FILENAME));
     castle.shape.setFillColor(CASTLE_COLOR);
     castle.shape.setSize(map.tileSize * 5.f);
     castle.shape.setOrigin(castle.shape.getGeometricCenter());
 
     sf::Vector2f offset(map.tileSize.x / 2, map.tileSize.y * -2.5f);
     castle.shape.setPosition(map.path.back().getPosition() + offset);
+
+    castle.body.Fit(castle.shape);
 }
 
 void Game::Start()
 {
     towers.clear();
-    enemies.clear();
-    bullets.clear();
+    enemies.Clear();
+    bullets.Clear();
     wave.enemies.clear();
+    enemyTexture = ctx.resources.FetchTexture(ENEMY_TEXTURE);
 
     StartStats();
     StartCastle();
@@ -122,10 +124,16 @@ void Game::StartStats()
 {
     stats.money = STATS_BASE_MONEY;
     stats.level = STATS_BASE_LEVEL;
+    stats.timeScale = 0;
+
+    ctx.time.SetTimeScale(TIME_SCALES[stats.timeScale]);
 }
 
 void Game::StartCastle()
 {
+    castleTexture = ctx.resources.FetchTexture(CASTLE_TEXTURE);
+    castle.shape.setTexture(castleTexture.Get());
+
     castle.health.maxPoints = castle.health.points = CASTLE_HEALTH;
 }
 
@@ -137,10 +145,12 @@ void Game::StartPreview()
 void Game::StartGui()
 {
     ui.statsLabel = tgui::Label::create();
+    ui.statsString.clear();
     auto statsPanel = tgui::Panel::create();
     statsPanel->add(ui.statsLabel);
 
     ui.waveLabel = tgui::Label::create();
+    ui.waveString.clear();
     auto wavePanel = tgui::Panel::create();
     wavePanel->add(ui.waveLabel);
 
@@ -170,6 +180,10 @@ void Game::HandleEvent(const sf::Event::KeyPressed& key)
     {
         preview.enabled = !preview.enabled;
     }
+    else if (key.scancode == sf::Keyboard::Scan::F)
+    {
+        EventTimeScaleNext();
+    }
 }
 
 void Game::HandleEvent(const sf::Event::MouseButtonPressed&)
@@ -195,12 +209,16 @@ void Game::HandleEvent(const sf::Event::JoystickButtonPressed& joystick)
         {
             preview.enabled = !preview.enabled;
         }
+        else if (*button == GamepadButton::East)
+        {
+            EventTimeScaleNext();
+        }
     }
 }
 
 void Game::Update()
 {
-    if (enemies.empty() && wave.enemies.empty())
+    if (enemies.IsEmpty() && wave.enemies.empty())
     {
         EventWaveNew();
         waveSpawnCooldown.Restart();
@@ -281,8 +299,9 @@ void Game::UpdateEnemies()
         }
 
         enemy.shape.move(enemy.direction * enemy.speed * ctx.time.GetDeltaTime());
+        enemy.body.SetPosition(enemy.shape.getPosition());
 
-        UpdateHealth(enemy.health, enemy.shape);
+        UpdateHealth(enemy.health, enemy.body);
     }
 }
 
@@ -294,7 +313,13 @@ void Game::UpdateEnemyDirection(Enemy& enemy)
     if (direction.length() > 1)
     {
         enemy.direction = direction.normalized();
-        enemy.shape.setRotation(enemy.direction.angle());
+
+        // Global bounds depend on the rotation, so the body is refit whenever the enemy turns
+        if (const sf::Angle rotation = enemy.direction.angle().wrapUnsigned(); rotation != enemy.shape.getRotation())
+        {
+            enemy.shape.setRotation(rotation);
+            enemy.body.Fit(enemy.shape);
+        }
     }
     else
     {
@@ -319,23 +344,24 @@ void Game::UpdateBullets()
     for (auto& bullet : bullets)
     {
         bullet.shape.move(bullet.direction * bullet.speed * ctx.time.GetDeltaTime());
+        bullet.body.SetPosition(bullet.shape.getPosition());
     }
 }
 
 void Game::UpdateCastle()
 {
-    UpdateHealth(castle.health, castle.shape);
+    UpdateHealth(castle.health, castle.body);
 }
 
-void Game::UpdateHealth(Health& health, const sf::Shape& shape)
+void Game::UpdateHealth(Health& health, const PhysicsBody& body)
 {
     health.barBackground.setFillColor(HEALTH_BACKGROUND_COLOR);
 
-    sf::Vector2f size = shape.getGlobalBounds().size;
+    sf::Vector2f size = body.GetHalfSize() * 2.f;
     health.barBackground.setSize({size.x, HEALTH_BAR_HEIGHT});
 
     sf::Vector2f offset(size.x / 2, size.y / 2 + map.tileSize.y / 2);
-    health.barBackground.setPosition(shape.getPosition() - offset);
+    health.barBackground.setPosition(body.GetPosition() - offset);
 
     health.bar.setFillColor(HEALTH_FOREGROUND_COLOR);
     health.bar.setSize({size.x * (health.points / (float)health.maxPoints), HEALTH_BAR_HEIGHT});
@@ -348,13 +374,26 @@ void Game::UpdateUI()
     ui.towerBar->setValue(int(towerSpawnCooldown.GetElapsedTime() / towerSpawnCooldown.GetDuration() * 100));
     ui.waveBar->setValue(int(waveSpawnCooldown.GetElapsedTime() / waveSpawnCooldown.GetDuration() * 100));
 
-    ui.waveLabel->setText(std::format("Wave elapsed time (s): {}\nNext Enemy (level): {}\nEnemies Left: {}",
+    const auto waveString = ctx.arena.Format("Wave elapsed time (s): {}\nNext Enemy (level): {}\nEnemies Left: {}",
         int(waveSpawnCooldown.GetElapsedTime()),
-        wave.enemies.empty() ? "None" : std::to_string(wave.enemies.back()),
+        wave.enemies.empty() ? ctx.arena.Format("None") : ctx.arena.Format("{}", wave.enemies.back()),
         wave.enemies.size()
-    ));
+    );
 
-    ui.statsLabel->setText("Money: " + std::to_string(stats.money) + '\n' + "Level: " + std::to_string(stats.level));
+    // setText copies into the heap and relayouts the label, so it only runs when the text changes
+    if (std::string_view(waveString) != ui.waveString)
+    {
+        ui.waveString = waveString;
+        ui.waveLabel->setText(ui.waveString);
+    }
+
+    const auto statsString = ctx.arena.Format("Money: {}\nLevel: {}\nSpeed: x{}", stats.money, stats.level, TIME_SCALES[stats.timeScale]);
+
+    if (std::string_view(statsString) != ui.statsString)
+    {
+        ui.statsString = statsString;
+        ui.statsLabel->setText(ui.statsString);
+    }
 }
 
 void Game::EventTowerPlacement()
@@ -417,7 +456,7 @@ void Game::EventTowerPlace(sf::Vector2f position)
 void Game::EventTowerShoot(Tower& tower)
 {
     auto enemyIt = std::ranges::find_if(enemies, [&](const Enemy& enemy) { 
-        return (bool)Intersects(tower.area, enemy.shape); 
+        return (bool)Intersects(tower.area, enemy.body.GetBounds()); 
     });
 
     if (enemyIt != enemies.end())
@@ -428,7 +467,14 @@ void Game::EventTowerShoot(Tower& tower)
 
 void Game::EventBulletSpawn(Tower& tower, const Enemy& target)
 {
-    auto& bullet = bullets.emplace_back();
+    Bullet* spawned = bullets.Spawn();
+
+    if (!spawned)
+    {
+        return;
+    }
+
+    auto& bullet = *spawned;
 
     bullet.shape.setFillColor(BULLET_COLOR);
     bullet.shape.setOutlineColor(sf::Color::Black);
@@ -436,6 +482,7 @@ void Game::EventBulletSpawn(Tower& tower, const Enemy& target)
     bullet.shape.setRadius(std::min(map.tileSize.x / 4.f, map.tileSize.y / 4.f));
     bullet.shape.setOrigin(bullet.shape.getGeometricCenter());
     bullet.shape.setPosition(tower.shape.getPosition());
+    bullet.body.Fit(bullet.shape);
 
     sf::Vector2f direction = target.shape.getPosition() - bullet.shape.getPosition();
     bullet.direction = direction.normalized();
@@ -453,14 +500,21 @@ void Game::EventWaveNew()
     stats.money += WAVE_MONEY_BONUS;
 
     wave.enemies.resize(stats.level);
-    std::ranges::generate(wave.enemies, [&] { return ctx.random.Int(1, 3); });
+    ctx.random.Stream(RandomStream::Gameplay).Fill(wave.enemies, 1, 3);
 
     enemySpawnCooldown.SetDuration(std::max(enemySpawnCooldown.GetDuration() * 0.9f, 0.25f));
 }
 
 void Game::EventEnemySpawn()
 {
-    auto& enemy = enemies.emplace_back();
+    Enemy* spawned = enemies.Spawn();
+
+    if (!spawned)
+    {
+        return;
+    }
+
+    auto& enemy = *spawned;
 
     enemy.level = wave.enemies.back();
     wave.enemies.pop_back();
@@ -469,14 +523,24 @@ void Game::EventEnemySpawn()
     enemy.speed = ENEMY_SPEED * (float)std::sqrt(enemy.level);
     enemy.damage = ENEMY_DAMAGE;
     enemy.pathIndex = 0;
+    enemy.direction = {};
 
-    enemy.shape.setTexture(ctx.resources.FetchTexture(ENEMY_TEXTURE_FILENAME));
+    enemy.shape.setTexture(enemyTexture.Get());
     enemy.shape.setFillColor(ENEMY_COLORS[enemy.level - 1]);
     enemy.shape.setOutlineColor(sf::Color::Black);
     enemy.shape.setOutlineThickness(-1);
     enemy.shape.setSize(map.tileSize);
     enemy.shape.setOrigin(enemy.shape.getGeometricCenter());
     enemy.shape.setPosition(map.path.front().getPosition() + map.tileSize / 2.f);
+    enemy.shape.setRotation(sf::Angle::Zero);
+    enemy.body.Fit(enemy.shape);
+}
+
+void Game::EventTimeScaleNext()
+{
+    stats.timeScale = (stats.timeScale + 1) % TIME_SCALES.size();
+
+    ctx.time.SetTimeScale(TIME_SCALES[stats.timeScale]);
 }
 
 void Game::HandleCollisions()
@@ -498,14 +562,14 @@ void Game::HandleCollisionsBullets()
         HandleCollisionsBulletEnemies(bullet);
     }
 
-    std::erase_if(bullets, [](const Bullet& bullet) { return !bullet.alive || IsOutsideWindow(bullet.shape.getPosition()); });
+    bullets.RemoveIf([](const Bullet& bullet) { return !bullet.alive || IsOutsideWindow(bullet.shape.getPosition()); });
 }
 
 void Game::HandleCollisionsBulletEnemies(Bullet& bullet)
 {
     for (auto& enemy : enemies)
     {
-        if (bullet.alive && enemy.health.points > 0 && Intersects(bullet.shape, enemy.shape))
+        if (bullet.alive && enemy.health.points > 0 && Intersects(bullet.body, enemy.body))
         {
             ResolveCollisionBulletEnemy(bullet, enemy);
         }
@@ -527,13 +591,13 @@ void Game::HandleCollisionsEnemies()
 {
     for (auto& enemy : enemies)
     {
-        if (enemy.health.points > 0 && Intersects(enemy.shape, castle.shape))
+        if (enemy.health.points > 0 && Intersects(enemy.body, castle.body))
         {
             ResolveCollisionEnemyCastle(enemy);
         }
     }
 
-    std::erase_if(enemies, [](const Enemy& enemy) { return enemy.health.points <= 0; });
+    enemies.RemoveIf([](const Enemy& enemy) { return enemy.health.points <= 0; });
 }
 
 void Game::ResolveCollisionEnemyCastle(Enemy& enemy)
@@ -626,33 +690,15 @@ void Game::Render() const
     }
 }
 
-void Game::OnPause(bool paused)
+ResourceManifest Game::GetManifest() const
 {
-    if (paused)
-    {
-        for (auto& tower : towers)
-        {
-            tower.shootCooldown.Stop();
-        }
-
-        waveSpawnCooldown.Stop();
-        enemySpawnCooldown.Stop();
-        towerSpawnCooldown.Stop();
-    }
-    else
-    {
-        for (auto& tower : towers)
-        {
-            tower.shootCooldown.Start();
-        }
-
-        waveSpawnCooldown.Start();
-        enemySpawnCooldown.Start();
-        towerSpawnCooldown.Start();
-    }
+    return {.textures = {CASTLE_TEXTURE, ENEMY_TEXTURE}};
 }
 
 void Game::OnCleanup()
 {
     ctx.gui.Remove(ui.container);
+
+    castleTexture = {};
+    enemyTexture = {};
 }
\ No newline at end of file
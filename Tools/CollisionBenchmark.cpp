@@ -0,0 +1,249 @@
+// Copyright (c) 2025 Adel Hales
+
+#include <SFML/Graphics/CircleShape.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "Utils/Log.h"
+#include "Utils/PhysicsBody.h"
+
+namespace
+{
+    // Mirrors the Breakout and Tower Defense layouts closely enough to reproduce their collision loops
+    const sf::Vector2f WINDOW_SIZE(800, 800);
+    const sf::Vector2i BRICK_MAP_SIZE(10, 7);
+    const int BALL_COUNT = 8;
+    const int ENEMY_COUNT = 64;
+    const int BULLET_COUNT = 128;
+    const int FRAME_COUNT = 20000;
+    const float DELTA_TIME = 1 / 60.f;
+
+    struct Entity
+    {
+        sf::RectangleShape shape;
+        PhysicsBody body;
+        sf::Vector2f velocity;
+    };
+
+    struct Projectile
+    {
+        sf::CircleShape shape;
+        PhysicsBody body;
+        sf::Vector2f velocity;
+    };
+
+    struct Breakout
+    {
+        Entity paddle;
+        std::vector<Entity> bricks;
+        std::vector<Projectile> balls;
+    };
+
+    struct TowerDefense
+    {
+        Entity castle;
+        std::vector<Entity> enemies;
+        std::vector<Projectile> bullets;
+    };
+
+    void InitEntity(Entity& entity, sf::Vector2f size, sf::Vector2f position, sf::Vector2f velocity, bool centered)
+    {
+        entity.shape.setSize(size);
+        entity.shape.setOrigin(centered ? entity.shape.getGeometricCenter() : sf::Vector2f());
+        entity.shape.setPosition(position);
+        entity.body.Fit(entity.shape);
+        entity.velocity = velocity;
+    }
+
+    void InitProjectile(Projectile& projectile, float radius, sf::Vector2f position, sf::Vector2f velocity)
+    {
+        projectile.shape.setRadius(radius);
+        projectile.shape.setOrigin(projectile.shape.getGeometricCenter());
+        projectile.shape.setPosition(position);
+        projectile.body.Fit(projectile.shape);
+        projectile.velocity = velocity;
+    }
+
+    // Keeps every mover inside the window, so the overlap pattern repeats instead of emptying out
+    template <class T>
+    void Move(T& mover, bool withBody)
+    {
+        sf::Vector2f position = mover.shape.getPosition() + mover.velocity * DELTA_TIME;
+        position.x = std::fmod(position.x + WINDOW_SIZE.x, WINDOW_SIZE.x);
+        position.y = std::fmod(position.y + WINDOW_SIZE.y, WINDOW_SIZE.y);
+        mover.shape.setPosition(position);
+
+        if (withBody)
+        {
+            mover.body.SetPosition(position);
+        }
+    }
+
+    Breakout MakeBreakout()
+    {
+        Breakout scene;
+
+        const sf::Vector2f brickSize(WINDOW_SIZE.x / BRICK_MAP_SIZE.x, WINDOW_SIZE.y / (BRICK_MAP_SIZE.y * 4.5f));
+
+        for (int i = 0; i < BRICK_MAP_SIZE.y; i++)
+        {
+            for (int j = 0; j < BRICK_MAP_SIZE.x; j++)
+            {
+                InitEntity(scene.bricks.emplace_back(), brickSize, sf::Vector2f(float(j), float(i)).componentWiseMul(brickSize), {}, false);
+            }
+        }
+
+        InitEntity(scene.paddle, WINDOW_SIZE.componentWiseMul({0.12f, 0.03f}), WINDOW_SIZE.componentWiseMul({0.5f, 0.9f}), {}, true);
+
+        for (int i = 0; i < BALL_COUNT; i++)
+        {
+            const sf::Vector2f direction(1, sf::degrees(45.f * float(i) + 20));
+            InitProjectile(scene.balls.emplace_back(), 10, WINDOW_SIZE / 2.f, direction * 650.f);
+        }
+
+        return scene;
+    }
+
+    TowerDefense MakeTowerDefense()
+    {
+        TowerDefense scene;
+
+        const sf::Vector2f tileSize = WINDOW_SIZE / 18.f;
+
+        InitEntity(scene.castle, tileSize * 5.f, WINDOW_SIZE.componentWiseMul({0.8f, 0.2f}), {}, true);
+
+        for (int i = 0; i < ENEMY_COUNT; i++)
+        {
+            const sf::Vector2f position(tileSize.x * float(i % 16 + 1), tileSize.y * float(i / 16 * 4 + 2));
+            InitEntity(scene.enemies.emplace_back(), tileSize, position, {80, 0}, true);
+        }
+
+        for (int i = 0; i < BULLET_COUNT; i++)
+        {
+            const sf::Vector2f direction(1, sf::degrees(360.f / BULLET_COUNT * float(i)));
+            InitProjectile(scene.bullets.emplace_back(), tileSize.x / 4, WINDOW_SIZE / 2.f, direction * 500.f);
+        }
+
+        return scene;
+    }
+
+    std::size_t StepShapes(Breakout& scene)
+    {
+        std::size_t hits = 0;
+
+        for (auto& ball : scene.balls)
+        {
+            Move(ball, false);
+            hits += ball.shape.getGlobalBounds().findIntersection(scene.paddle.shape.getGlobalBounds()).has_value();
+
+            for (const auto& brick : scene.bricks)
+            {
+                hits += ball.shape.getGlobalBounds().findIntersection(brick.shape.getGlobalBounds()).has_value();
+            }
+        }
+
+        return hits;
+    }
+
+    std::size_t StepBodies(Breakout& scene)
+    {
+        std::size_t hits = 0;
+
+        for (auto& ball : scene.balls)
+        {
+            Move(ball, true);
+            hits += Intersects(ball.body, scene.paddle.body).has_value();
+
+            for (const auto& brick : scene.bricks)
+            {
+                hits += Intersects(ball.body, brick.body).has_value();
+            }
+        }
+
+        return hits;
+    }
+
+    std::size_t StepShapes(TowerDefense& scene)
+    {
+        std::size_t hits = 0;
+
+        for (auto& enemy : scene.enemies)
+        {
+            Move(enemy, false);
+            hits += enemy.shape.getGlobalBounds().findIntersection(scene.castle.shape.getGlobalBounds()).has_value();
+        }
+
+        for (auto& bullet : scene.bullets)
+        {
+            Move(bullet, false);
+
+            for (const auto& enemy : scene.enemies)
+            {
+                hits += bullet.shape.getGlobalBounds().findIntersection(enemy.shape.getGlobalBounds()).has_value();
+            }
+        }
+
+        return hits;
+    }
+
+    std::size_t StepBodies(TowerDefense& scene)
+    {
+        std::size_t hits = 0;
+
+        for (auto& enemy : scene.enemies)
+        {
+            Move(enemy, true);
+            hits += Intersects(enemy.body, scene.castle.body).has_value();
+        }
+
+        for (auto& bullet : scene.bullets)
+        {
+            Move(bullet, true);
+
+            for (const auto& enemy : scene.enemies)
+            {
+                hits += Intersects(bullet.body, enemy.body).has_value();
+            }
+        }
+
+        return hits;
+    }
+
+    template <class Scene, class Step>
+    double Measure(Scene scene, Step step, std::size_t& hits)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < FRAME_COUNT; i++)
+        {
+            hits += step(scene);
+        }
+
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / FRAME_COUNT;
+    }
+
+    template <class Scene>
+    void Compare(std::string_view name, const Scene& scene)
+    {
+        std::size_t shapeHits = 0;
+        std::size_t bodyHits = 0;
+
+        const double shapeTime = Measure(scene, [](Scene& frame) { return StepShapes(frame); }, shapeHits);
+        const double bodyTime = Measure(scene, [](Scene& frame) { return StepBodies(frame); }, bodyHits);
+
+        LOG_INFO("{}: shapes {:.2f} us/frame, bodies {:.2f} us/frame, x{:.1f} ({} / {} hits)",
+                 name, shapeTime, bodyTime, shapeTime / bodyTime, shapeHits, bodyHits);
+    }
+}
+
+int main()
+{
+    Compare("Breakout", MakeBreakout());
+    Compare("Tower Defense", MakeTowerDefense());
+    return 0;
+}
\ No newline at end of file
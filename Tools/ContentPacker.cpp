@@ -0,0 +1,164 @@
+// Copyright (c) 2025 Adel Hales
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Utils/ContentArchive.h"
+#include "Utils/Log.h"
+#include "Utils/Lz4.h"
+
+namespace
+{
+    // Only the directories served by the ResourceManager, the rest is still read from loose files
+    const std::vector<std::string> PACKED_DIRECTORIES = {"Textures", "Sounds", "Fonts", "Musics"};
+
+    // Root the engine opens loose files from, whatever the content directory argument was spelled as
+    const std::filesystem::path CONTENT_ROOT = "Content";
+
+    // Already compressed formats (png, ogg, …) rarely shrink, so they are kept stored for zero-copy loading
+    constexpr double MIN_COMPRESSION_GAIN = 0.1;
+
+    struct PackedFile
+    {
+        std::string path;
+        std::vector<std::byte> data;
+        std::size_t originalSize;
+        bool compressed;
+    };
+
+    std::vector<std::byte> ReadFile(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        const std::vector<char> bytes(std::istreambuf_iterator<char>(file), {});
+        const auto span = std::as_bytes(std::span(bytes));
+
+        return {span.begin(), span.end()};
+    }
+
+    std::size_t Align(std::size_t offset)
+    {
+        return (offset + CONTENT_ARCHIVE_ALIGNMENT - 1) / CONTENT_ARCHIVE_ALIGNMENT * CONTENT_ARCHIVE_ALIGNMENT;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        LOG_ERROR("Usage: ContentPacker <content directory> <archive file> [--compress]");
+        return 1;
+    }
+
+    const std::filesystem::path contentPath = argv[1];
+    const std::filesystem::path archivePath = argv[2];
+    const bool compress = (argc > 3 && std::string_view(argv[3]) == "--compress");
+
+    std::vector<PackedFile> files;
+
+    for (const auto& directory : PACKED_DIRECTORIES)
+    {
+        if (!std::filesystem::is_directory(contentPath / directory))
+        {
+            continue;
+        }
+
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(contentPath / directory))
+        {
+            if (!entry.is_regular_file())
+            {
+                continue;
+            }
+
+            // Entries are keyed by the same path the loose file would be opened with
+            PackedFile file;
+            file.path = (CONTENT_ROOT / entry.path().lexically_relative(contentPath)).generic_string();
+            file.data = ReadFile(entry.path());
+            file.originalSize = file.data.size();
+            file.compressed = false;
+
+            if (compress)
+            {
+                auto compressed = CompressLz4(file.data);
+
+                if (compressed.size() < file.originalSize * (1 - MIN_COMPRESSION_GAIN))
+                {
+                    file.data = std::move(compressed);
+                    file.compressed = true;
+                }
+            }
+
+            files.push_back(std::move(file));
+        }
+    }
+
+    std::ranges::sort(files, {}, &PackedFile::path);
+
+    // Two files under one key would leave one of them unreachable, so the archive is not written at all
+    if (const auto duplicate = std::ranges::adjacent_find(files, {}, &PackedFile::path); duplicate != files.end())
+    {
+        LOG_ERROR("Duplicate archive entry: {}", duplicate->path);
+        return 1;
+    }
+
+    ContentArchiveHeader header;
+    header.entryCount = std::uint32_t(files.size());
+
+    for (const auto& file : files)
+    {
+        header.indexSize += std::uint32_t(sizeof(ContentArchiveEntry) + file.path.size());
+    }
+
+    std::ofstream output(archivePath, std::ios::binary);
+
+    if (!output)
+    {
+        LOG_ERROR("Failed to create archive: {}", archivePath.string());
+        return 1;
+    }
+
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    std::size_t offset = Align(sizeof(header) + header.indexSize);
+
+    for (const auto& file : files)
+    {
+        ContentArchiveEntry entry;
+        entry.offset = offset;
+        entry.storedSize = file.data.size();
+        entry.originalSize = file.originalSize;
+        entry.compressed = file.compressed;
+        entry.pathLength = std::uint32_t(file.path.size());
+
+        output.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+        output.write(file.path.data(), std::streamsize(file.path.size()));
+
+        offset = Align(offset + file.data.size());
+    }
+
+    std::size_t storedSize = 0;
+    std::size_t originalSize = 0;
+
+    for (const auto& file : files)
+    {
+        const std::vector<char> padding(Align(std::size_t(output.tellp())) - std::size_t(output.tellp()));
+        output.write(padding.data(), std::streamsize(padding.size()));
+        output.write(reinterpret_cast<const char*>(file.data.data()), std::streamsize(file.data.size()));
+
+        storedSize += file.data.size();
+        originalSize += file.originalSize;
+    }
+
+    if (!output)
+    {
+        LOG_ERROR("Failed to write archive: {}", archivePath.string());
+        return 1;
+    }
+
+    LOG_INFO("Packed {} files into {} ({} / {} bytes)", files.size(), archivePath.string(), storedSize, originalSize);
+    return 0;
+}
\ No newline at end of file